@@ -0,0 +1,205 @@
+// Host benchmark of the logging pipeline: printf() (or the esp_log bridge)
+// -> queue -> drain task -> backlog ring -> WebSocket clients, against the
+// FreeRTOS/AsyncWebSocket shims in shim/. See README.md ("Host benchmark").
+//
+//   ./bench lines=200000 clients=3 slow=1 len=80 producers=2 ring=32768
+#include "AsyncWebConsole.h"
+#include <atomic>
+#include <thread>
+#include <vector>
+#include <algorithm>
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+// Allocation counter: every malloc/calloc/realloc while a run is measured
+// (operator new goes through malloc). Includes the shim's own frame buffers,
+// which AsyncWebSocket allocates on the device too.
+static std::atomic<bool>     g_count{false};
+static std::atomic<uint64_t> g_allocs{0};
+#if defined(__GLIBC__)
+extern "C" void* __libc_malloc(size_t);
+extern "C" void* __libc_calloc(size_t, size_t);
+extern "C" void* __libc_realloc(void*, size_t);
+extern "C" void* malloc(size_t n) { if (g_count.load(std::memory_order_relaxed)) g_allocs++; return __libc_malloc(n); }
+extern "C" void* calloc(size_t a, size_t b) { if (g_count.load(std::memory_order_relaxed)) g_allocs++; return __libc_calloc(a, b); }
+extern "C" void* realloc(void* p, size_t n) { if (g_count.load(std::memory_order_relaxed)) g_allocs++; return __libc_realloc(p, n); }
+#define AWC_BENCH_ALLOCS 1
+#endif
+
+struct Opts {
+  uint32_t lines = 200000, producers = 1, clients = 2, slow = 0, len = 80, rate = 0;
+  uint32_t slowFrames = 1, slowMs = 5, clientQueue = 32;
+  uint32_t queue = 256, batch = 16, ring = 0, backlog = 32768, bin = 0, lz = 0, idf = 0, deferred = 0, ts = 1;
+};
+
+static bool parseOpt(Opts& o, const char* a){
+  struct { const char* k; uint32_t* v; } keys[] = {
+    {"lines", &o.lines}, {"producers", &o.producers}, {"clients", &o.clients}, {"slow", &o.slow},
+    {"len", &o.len}, {"rate", &o.rate}, {"slowFrames", &o.slowFrames}, {"slowMs", &o.slowMs},
+    {"clientQueue", &o.clientQueue}, {"queue", &o.queue}, {"batch", &o.batch}, {"ring", &o.ring},
+    {"backlog", &o.backlog}, {"bin", &o.bin}, {"lz", &o.lz}, {"idf", &o.idf}, {"deferred", &o.deferred},
+    {"ts", &o.ts},
+  };
+  const char* eq = strchr(a, '=');
+  if (!eq) return false;
+  for (auto& k : keys) {
+    if (strlen(k.k) == static_cast<size_t>(eq - a) && !strncmp(a, k.k, eq - a)) { *k.v = strtoul(eq + 1, nullptr, 10); return true; }
+  }
+  return false;
+}
+
+// One simulated browser: fast ones read as soon as a frame is queued, slow
+// ones take slowFrames frames every slowMs. Lines are "bench <seq> <t_us> ...",
+// so the first fast client also measures enqueue -> on-the-wire latency.
+struct ClientSim {
+  AsyncWebSocketClient* cli = nullptr;
+  bool slow = false, ref = false;
+  uint64_t frames = 0, bytes = 0, lines = 0;
+  std::vector<uint32_t> lat;
+};
+
+static bool g_scan = true; // lz frames can't be scanned for lines
+
+static void scanFrame(ClientSim& s, const HostFrame& f){
+  s.frames++;
+  s.bytes += f.data->size();
+  if (!g_scan) return;
+  const char* p = reinterpret_cast<const char*>(f.data->data());
+  const char* end = p + f.data->size();
+  uint32_t now = micros();
+  static const char kKey[] = "bench ";
+  while ((p = static_cast<const char*>(memmem(p, end - p, kKey, sizeof(kKey) - 1))) != nullptr) {
+    p += sizeof(kKey) - 1;
+    char* q;
+    strtoul(p, &q, 10);
+    uint32_t t = strtoul(q, &q, 10);
+    s.lines++;
+    if (s.ref && s.lat.size() < s.lat.capacity()) s.lat.push_back(now - t);
+    p = q;
+  }
+}
+
+static uint32_t pct(std::vector<uint32_t>& v, double p){
+  if (v.empty()) return 0;
+  size_t i = std::min(v.size() - 1, static_cast<size_t>(p * v.size()));
+  std::nth_element(v.begin(), v.begin() + i, v.end());
+  return v[i];
+}
+
+int main(int argc, char** argv){
+  Opts o;
+  for (int i = 1; i < argc; i++) {
+    if (!parseOpt(o, argv[i])) { fprintf(stderr, "unknown option %s (see bench.cpp: Opts)\n", argv[i]); return 2; }
+  }
+  o.producers = std::max<uint32_t>(o.producers, 1);
+  o.len = std::max<uint32_t>(o.len, 40);
+  g_scan = !o.lz;
+
+  AsyncWebConsole::Config cfg;
+  cfg.queueLen = o.queue;
+  cfg.drainBatch = o.batch;
+  cfg.ringBytes = o.ring;
+  cfg.timestamps = o.ts != 0;
+  cfg.wsBinary = o.bin != 0;
+  cfg.wsCompress = o.lz != 0;
+  cfg.deferredFormat = o.deferred != 0;
+  cfg.idfPassthrough = false;
+  cfg.maxLineLen = std::max<size_t>(cfg.maxLineLen, o.len + 32);
+  AsyncWebServer server(80);
+  AsyncWebConsole console("/ws", o.backlog, cfg);
+  console.attachTo(server, "/");
+  if (o.idf) console.enableEspLogBridge();
+  AsyncWebSocket* ws = static_cast<AsyncWebSocket*>(server.handlers.back());
+
+  // Connect, then drop the banner/help output before measuring
+  std::vector<ClientSim> sims(o.clients);
+  AsyncWebServerRequest req;
+  if (o.bin) req.params.push_back(AsyncWebParameter("bin", "1"));
+  if (o.lz) req.params.push_back(AsyncWebParameter("lz", "1"));
+  for (uint32_t i = 0; i < o.clients; i++) {
+    sims[i].cli = ws->hostConnect(&req);
+    sims[i].cli->maxQueue = o.clientQueue;
+    sims[i].slow = i >= o.clients - std::min(o.slow, o.clients);
+  }
+  for (auto& s : sims) { if (!s.slow) { s.ref = true; s.lat.reserve(o.lines); break; } }
+  vTaskDelay(50);
+  for (auto& s : sims) s.cli->drain(SIZE_MAX, [](const HostFrame&){});
+  console.resetStats();
+
+  std::atomic<bool> stop{false};
+  std::vector<std::thread> readers;
+  for (auto& s : sims) {
+    readers.emplace_back([&s, &stop, &o]{
+      auto fn = [&s](const HostFrame& f){ scanFrame(s, f); };
+      while (!stop.load()) {
+        if (s.slow) { s.cli->drain(o.slowFrames, fn); vTaskDelay(o.slowMs); }
+        else if (!s.cli->drain(SIZE_MAX, fn)) std::this_thread::yield();
+      }
+      s.cli->drain(SIZE_MAX, fn);
+    });
+  }
+
+#if AWC_BENCH_ALLOCS
+  malloc_trim(0);
+#endif
+  g_allocs = 0;
+  g_count = true;
+  uint32_t t0 = micros();
+  std::vector<std::thread> producers;
+  for (uint32_t p = 0; p < o.producers; p++) {
+    producers.emplace_back([&, p]{
+      std::string pad(o.len - 32, 'x');
+      uint32_t n = o.lines / o.producers + (p < o.lines % o.producers ? 1 : 0);
+      for (uint32_t i = 0; i < n; i++) {
+        if (o.rate) {
+          uint32_t due = t0 + static_cast<uint32_t>((static_cast<uint64_t>(i) * o.producers * 1000000) / o.rate);
+          while (static_cast<int32_t>(micros() - due) < 0) std::this_thread::yield();
+        }
+        if (o.idf) ESP_LOGI("bench", "bench %u %u %s", static_cast<unsigned>(p * n + i), static_cast<unsigned>(micros()), pad.c_str());
+        else console.printf("bench %u %u %s\n", static_cast<unsigned>(p * n + i), static_cast<unsigned>(micros()), pad.c_str());
+      }
+    });
+  }
+  for (auto& t : producers) t.join();
+  uint32_t tProduced = micros();
+
+  // Done when the queue is empty and nothing was published for 100 ms
+  uint32_t lastLines = ~0u, tDone = micros();
+  for (int i = 0; i < 2000; i++) {
+    auto st = console.stats();
+    if (st.lines != lastLines || st.queueDepth) { lastLines = st.lines; tDone = micros(); }
+    else if (micros() - tDone > 100000) break;
+    vTaskDelay(1);
+  }
+  g_count = false;
+  uint64_t allocs = g_allocs;
+  stop = true;
+  for (auto& t : readers) t.join();
+
+  auto st = console.stats();
+  double secs = (tDone - t0) / 1e6;
+  printf("AsyncWebConsole host bench: lines=%u producers=%u len=%u clients=%u (slow %u) queue=%u batch=%u ring=%u backlog=%u%s%s%s%s\n",
+         o.lines, o.producers, o.len, o.clients, std::min(o.slow, o.clients), o.queue, o.batch, o.ring, o.backlog,
+         o.bin ? " bin" : "", o.lz ? " lz" : "", o.idf ? " idf" : "", o.deferred ? " deferred" : "");
+  printf("produce     %10.1f ms (%.0f lines/s offered)\n", (tProduced - t0) / 1e3, o.lines / ((tProduced - t0) / 1e6));
+  printf("publish     %10u lines  %10.0f lines/s  %8.2f MB/s\n", st.lines, st.lines / secs, st.bytes / secs / 1e6);
+#if AWC_BENCH_ALLOCS
+  printf("allocs      %10.2f per line (%llu)\n", o.lines ? static_cast<double>(allocs) / o.lines : 0.0, static_cast<unsigned long long>(allocs));
+#else
+  printf("allocs      n/a (needs glibc)\n");
+#endif
+  printf("drops       queue=%u nomem=%u filtered=%u evicted=%u wsSkipped=%u sinkSkipped=%u\n",
+         st.droppedQueue, st.droppedNoMem, st.filtered, st.backlogEvicted, st.wsSkipped, st.sinkSkipped);
+  printf("queue       high=%u of %u\n", st.queueHigh, o.queue);
+  for (size_t i = 0; i < sims.size(); i++) {
+    auto& s = sims[i];
+    printf("client %-2zu   %s frames=%llu bytes=%llu", i + 1, s.slow ? "slow" : "fast",
+           static_cast<unsigned long long>(s.frames), static_cast<unsigned long long>(s.bytes));
+    if (!g_scan) printf(" lines/latency n/a (lz frames)");
+    else printf(" lines=%llu (%.1f%%)", static_cast<unsigned long long>(s.lines), st.lines ? 100.0 * s.lines / st.lines : 0.0);
+    if (s.ref && g_scan) printf(" latency p50=%uus p99=%uus max=%uus", pct(s.lat, 0.50), pct(s.lat, 0.99), pct(s.lat, 1.0));
+    printf("\n");
+  }
+  return 0;
+}
@@ -0,0 +1,124 @@
+#pragma once
+// Host shim of the Arduino-ESP32 core subset AsyncWebConsole uses (bench only).
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+#include <chrono>
+#include "freertos/FreeRTOS.h"
+#include "esp_log.h"
+
+#define PROGMEM
+#define F(s) (s)
+#define FPSTR(s) (s)
+#define ARDUINO_ARCH_ESP32 1
+#define IRAM_ATTR
+#define RTC_NOINIT_ATTR
+using std::min; using std::max;
+typedef const char __FlashStringHelper;
+inline uint32_t millis(){ using namespace std::chrono; static auto t0=steady_clock::now(); return (uint32_t)duration_cast<milliseconds>(steady_clock::now()-t0).count(); }
+inline uint32_t micros(){ using namespace std::chrono; static auto t0=steady_clock::now(); return (uint32_t)duration_cast<microseconds>(steady_clock::now()-t0).count(); }
+void delay(uint32_t ms);
+inline void yield(){}
+
+class String {
+public:
+  String() {}
+  String(const char* s) { if (s) _s = s; }
+  String(const char* s, size_t n) { if (s) _s.assign(s, n); }
+  String(const String&) = default;
+  String(String&&) = default;
+  String& operator=(const String&) = default;
+  String& operator=(String&&) = default;
+  String& operator=(const char* s){ _s = s ? s : ""; return *this; }
+  explicit String(char c) : _s(1, c) {}
+  explicit String(int v) : _s(std::to_string(v)) {}
+  explicit String(unsigned v) : _s(std::to_string(v)) {}
+  explicit String(long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned long v) : _s(std::to_string(v)) {}
+  explicit String(long long v) : _s(std::to_string(v)) {}
+  explicit String(unsigned long long v) : _s(std::to_string(v)) {}
+  explicit String(double v, unsigned d = 2) { char b[64]; snprintf(b, sizeof b, "%.*f", d, v); _s = b; }
+  unsigned length() const { return (unsigned)_s.size(); }
+  const char* c_str() const { return _s.c_str(); }
+  char* begin() { return &_s[0]; }
+  bool reserve(unsigned n) { _s.reserve(n); return true; }
+  bool concat(const char* s, unsigned n) { if (!s) return false; _s.append(s, n); return true; }
+  bool concat(const char* s) { if (!s) return false; _s.append(s); return true; }
+  bool concat(const String& s) { _s += s._s; return true; }
+  String& operator+=(const String& s){ _s += s._s; return *this; }
+  String& operator+=(const char* s){ if (s) _s += s; return *this; }
+  String& operator+=(char c){ _s += c; return *this; }
+  String& operator+=(int v){ _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned v){ _s += std::to_string(v); return *this; }
+  String& operator+=(long v){ _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned long v){ _s += std::to_string(v); return *this; }
+  String& operator+=(long long v){ _s += std::to_string(v); return *this; }
+  String& operator+=(unsigned long long v){ _s += std::to_string(v); return *this; }
+  friend String operator+(const String& a, const String& b){ String r(a); r += b; return r; }
+  friend String operator+(const String& a, const char* b){ String r(a); r += b; return r; }
+  friend String operator+(const char* a, const String& b){ String r(a); r += b; return r; }
+  friend String operator+(const String& a, char b){ String r(a); r += b; return r; }
+  bool operator==(const String& o) const { return _s == o._s; }
+  bool operator==(const char* o) const { return _s == (o ? o : ""); }
+  bool operator!=(const String& o) const { return _s != o._s; }
+  bool operator!=(const char* o) const { return !(*this == o); }
+  char operator[](unsigned i) const { return i < _s.size() ? _s[i] : 0; }
+  char& operator[](unsigned i) { return _s[i]; }
+  char charAt(unsigned i) const { return (*this)[i]; }
+  int indexOf(char c, unsigned from = 0) const { auto p = _s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int indexOf(const char* c, unsigned from = 0) const { auto p = _s.find(c, from); return p == std::string::npos ? -1 : (int)p; }
+  int lastIndexOf(char c) const { auto p = _s.rfind(c); return p == std::string::npos ? -1 : (int)p; }
+  bool startsWith(const String& p) const { return _s.compare(0, p._s.size(), p._s) == 0; }
+  bool startsWith(const char* p) const { return startsWith(String(p)); }
+  bool endsWith(const String& p) const { return _s.size() >= p._s.size() && _s.compare(_s.size()-p._s.size(), p._s.size(), p._s) == 0; }
+  bool endsWith(const char* p) const { return endsWith(String(p)); }
+  bool equalsIgnoreCase(const String& o) const { return strcasecmp(_s.c_str(), o._s.c_str()) == 0; }
+  bool equalsIgnoreCase(const char* o) const { return strcasecmp(_s.c_str(), o ? o : "") == 0; }
+  String substring(unsigned a) const { return a < _s.size() ? String(_s.substr(a).c_str()) : String(); }
+  String substring(unsigned a, unsigned b) const { if (a > b) std::swap(a,b); if (a >= _s.size()) return String(); return String(_s.substr(a, b-a).c_str()); }
+  void remove(unsigned i) { if (i < _s.size()) _s.erase(i); }
+  void remove(unsigned i, unsigned n) { if (i < _s.size()) _s.erase(i, n); }
+  void trim() { size_t a = 0, b = _s.size(); while (a < b && isspace((unsigned char)_s[a])) a++; while (b > a && isspace((unsigned char)_s[b-1])) b--; _s = _s.substr(a, b-a); }
+  void toLowerCase() { for (auto& c : _s) c = (char)tolower((unsigned char)c); }
+  long toInt() const { return strtol(_s.c_str(), nullptr, 10); }
+  bool isEmpty() const { return _s.empty(); }
+private:
+  std::string _s;
+};
+
+class Print {
+public:
+  virtual ~Print() {}
+  virtual size_t write(uint8_t c) = 0;
+  virtual size_t write(const uint8_t* b, size_t n) { size_t i = 0; for (; i < n; i++) if (!write(b[i])) break; return i; }
+  size_t write(const char* s) { return s ? write((const uint8_t*)s, strlen(s)) : 0; }
+  size_t write(const char* s, size_t n) { return write((const uint8_t*)s, n); }
+  virtual int availableForWrite() { return 0; }
+  virtual void flush() {}
+  size_t print(const char* s) { return write(s); }
+  size_t print(const String& s) { return write(s.c_str(), s.length()); }
+  size_t println(const char* s) { size_t n = write(s); return n + write("\r\n"); }
+  size_t printf(const char* fmt, ...) __attribute__((format(printf, 2, 3))) { char b[512]; va_list ap; va_start(ap, fmt); int n = vsnprintf(b, sizeof b, fmt, ap); va_end(ap); return n > 0 ? write(b, min((size_t)n, sizeof b - 1)) : 0; }
+};
+
+class HostSerial : public Print {
+public:
+  size_t write(uint8_t c) override { fputc(c, stdout); return 1; }
+  size_t write(const uint8_t* b, size_t n) override { return fwrite(b, 1, n, stdout); }
+  void begin(unsigned long) {}
+};
+extern HostSerial Serial;
+
+class EspClass {
+public:
+  uint32_t getFreeHeap();
+  uint32_t getMinFreeHeap();
+  uint32_t getHeapSize() { return 320 * 1024; }
+};
+extern EspClass ESP;
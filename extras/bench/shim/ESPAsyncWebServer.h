@@ -0,0 +1,173 @@
+#pragma once
+// Host fake of the ESPAsyncWebServer subset AsyncWebConsole uses. Clients keep
+// their frames in a queue until the bench's consumer threads drain them.
+#include <Arduino.h>
+#include <functional>
+#include <deque>
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+
+typedef enum { WS_EVT_CONNECT, WS_EVT_DISCONNECT, WS_EVT_PING, WS_EVT_PONG, WS_EVT_ERROR, WS_EVT_DATA } AwsEventType;
+typedef enum { WS_CONTINUATION, WS_TEXT, WS_BINARY, WS_DISCONNECT = 0x08, WS_PING, WS_PONG } AwsFrameType;
+typedef struct { uint8_t message_opcode; uint32_t num; uint8_t final; uint8_t masked; uint8_t opcode; uint64_t len; uint8_t mask[4]; uint64_t index; } AwsFrameInfo;
+typedef enum { HTTP_GET = 1, HTTP_POST = 2, HTTP_ANY = 0xFF } WebRequestMethod;
+typedef uint8_t WebRequestMethodComposite;
+
+class AsyncWebSocketMessageBuffer {
+public:
+  explicit AsyncWebSocketMessageBuffer(size_t n) : _buf(std::make_shared<std::vector<uint8_t>>(n)) {}
+  uint8_t* get() { return _buf->data(); }
+  size_t length() const { return _buf->size(); }
+  std::shared_ptr<std::vector<uint8_t>> _buf;
+};
+
+class AsyncWebSocket;
+class AsyncWebSocketClient;
+// TCP side of a client: space() models the lwIP send buffer minus bytes still queued
+class AsyncClient {
+public:
+  explicit AsyncClient(AsyncWebSocketClient* c) : _c(c) {}
+  size_t space() const;
+  bool canSend() const { return space() > 0; }
+  size_t sndBuf = 5744;
+private:
+  AsyncWebSocketClient* _c;
+};
+struct HostFrame { bool binary; std::shared_ptr<std::vector<uint8_t>> data; };
+
+class AsyncWebSocketClient {
+public:
+  AsyncWebSocketClient(AsyncWebSocket* s, uint32_t id) : _server(s), _id(id), _tcp(this) {}
+  AsyncClient* client() { return &_tcp; }
+  size_t queuedBytes() const;
+  uint32_t id() const { return _id; }
+  AsyncWebSocket* server() { return _server; }
+  bool canSend() const;
+  bool queueIsFull() const { return !canSend(); }
+  size_t queueLen() const;
+  void setCloseClientOnQueueFull(bool) {}
+  bool text(const char* m, size_t n) { return _push(false, (const uint8_t*)m, n); }
+  bool text(const char* m) { return text(m, strlen(m)); }
+  bool text(const String& m) { return text(m.c_str(), m.length()); }
+  bool text(AsyncWebSocketMessageBuffer* b) { bool ok = _pushShared(false, b->_buf); delete b; return ok; }
+  bool binary(const uint8_t* m, size_t n) { return _push(true, m, n); }
+  bool binary(const char* m, size_t n) { return _push(true, (const uint8_t*)m, n); }
+  bool binary(AsyncWebSocketMessageBuffer* b) { bool ok = _pushShared(true, b->_buf); delete b; return ok; }
+  void close(uint16_t = 0, const char* = nullptr);
+  // bench knobs
+  size_t maxQueue = 32;       // ESPAsyncWebServer: WS_MAX_QUEUED_MESSAGES
+  std::deque<HostFrame> queue; // frames not yet "on the wire"
+  // Takes up to maxFrames frames off the queue and hands them to fn
+  size_t drain(size_t maxFrames, const std::function<void(const HostFrame&)>& fn);
+  bool _pushShared(bool bin, std::shared_ptr<std::vector<uint8_t>> d);
+private:
+  bool _push(bool bin, const uint8_t* m, size_t n) { return _pushShared(bin, std::make_shared<std::vector<uint8_t>>(m, m + n)); }
+  AsyncWebSocket* _server;
+  uint32_t _id;
+  AsyncClient _tcp;
+};
+
+class AsyncWebServerRequest;
+class AsyncWebHandler { public: virtual ~AsyncWebHandler() {} };
+typedef std::function<void(AsyncWebSocket*, AsyncWebSocketClient*, AwsEventType, void*, uint8_t*, size_t)> AwsEventHandler;
+
+class AsyncWebSocket : public AsyncWebHandler {
+public:
+  explicit AsyncWebSocket(const char* url) : _url(url) {}
+  void onEvent(AwsEventHandler h) { _h = h; }
+  size_t count() const;
+  AsyncWebSocketClient* client(uint32_t id);
+  bool availableForWriteAll();
+  bool availableForWrite(uint32_t id) { auto* c = client(id); return c && c->canSend(); }
+  AsyncWebSocketMessageBuffer* makeBuffer(size_t n) { return new AsyncWebSocketMessageBuffer(n); }
+  void textAll(AsyncWebSocketMessageBuffer* b);
+  void textAll(const char* m, size_t n);
+  void textAll(const char* m) { textAll(m, strlen(m)); }
+  void textAll(const String& m) { textAll(m.c_str(), m.length()); }
+  void binaryAll(AsyncWebSocketMessageBuffer* b);
+  void binaryAll(const uint8_t* m, size_t n);
+  void cleanupClients(uint16_t = 8) {}
+  // bench knobs
+  AsyncWebSocketClient* hostConnect(void* request = nullptr);
+  void hostDisconnect(uint32_t id);
+  void hostSend(uint32_t id, const char* text, bool binary = false, size_t len = (size_t)-1);
+  std::list<AsyncWebSocketClient> clients;
+  std::recursive_mutex lock;
+private:
+  const char* _url;
+  AwsEventHandler _h;
+  uint32_t _nextId = 1;
+};
+
+class AsyncWebParameter {
+public:
+  AsyncWebParameter(const String& n, const String& v) : _n(n), _v(v) {}
+  const String& name() const { return _n; }
+  const String& value() const { return _v; }
+private:
+  String _n, _v;
+};
+
+class AsyncWebServerResponse {
+public:
+  virtual ~AsyncWebServerResponse() {}
+  void addHeader(const char* n, const char* v) { headers.push_back({n, v}); }
+  void addHeader(const String& n, const String& v) { headers.push_back({n, v}); }
+  void setContentLength(size_t n) { contentLength = n; }
+  int code = 200;
+  String contentType;
+  std::vector<std::pair<String, String>> headers;
+  std::string body;
+  size_t contentLength = 0;
+};
+class AsyncResponseStream : public AsyncWebServerResponse, public Print {
+public:
+  size_t write(uint8_t c) override { body.push_back((char)c); return 1; }
+  size_t write(const uint8_t* b, size_t n) override { body.append((const char*)b, n); return n; }
+};
+typedef std::function<size_t(uint8_t*, size_t, size_t)> AwsResponseFiller;
+class AsyncChunkedResponse : public AsyncWebServerResponse { public: AwsResponseFiller filler; };
+
+class AsyncWebServerRequest {
+public:
+  String urlPath;
+  std::vector<AsyncWebParameter> params;
+  std::vector<std::pair<String, String>> reqHeaders;
+  AsyncWebServerResponse* sent = nullptr;
+  const String& url() const { return urlPath; }
+  bool hasParam(const char* n, bool = false, bool = false) const { for (auto& p : params) if (p.name() == n) return true; return false; }
+  const AsyncWebParameter* getParam(const char* n, bool = false, bool = false) const { for (auto& p : params) if (p.name() == n) return &p; return nullptr; }
+  bool hasHeader(const char* n) const { for (auto& h : reqHeaders) if (h.first.equalsIgnoreCase(n)) return true; return false; }
+  String header(const char* n) const { for (auto& h : reqHeaders) if (h.first.equalsIgnoreCase(n)) return h.second; return String(); }
+  AsyncResponseStream* beginResponseStream(const char* type, size_t = 1460) { auto* r = new AsyncResponseStream(); r->contentType = type; return r; }
+  AsyncWebServerResponse* beginResponse(int code, const char* type, const String& content = String()) { auto* r = new AsyncWebServerResponse(); r->code = code; r->contentType = type; r->body.assign(content.c_str(), content.length()); return r; }
+  AsyncWebServerResponse* beginResponse(int code, const char* type, const uint8_t* content, size_t len) { auto* r = new AsyncWebServerResponse(); r->code = code; r->contentType = type; r->body.assign((const char*)content, len); return r; }
+  AsyncWebServerResponse* beginResponse_P(int code, const char* type, const uint8_t* content, size_t len) { return beginResponse(code, type, content, len); }
+  AsyncWebServerResponse* beginChunkedResponse(const char* type, AwsResponseFiller f) { auto* r = new AsyncChunkedResponse(); r->contentType = type; r->filler = f; return r; }
+  void send(AsyncWebServerResponse* r) { delete sent; sent = r; }
+  void send(int code, const char* type = "", const String& content = String()) { send(beginResponse(code, type, content)); }
+  void onDisconnect(std::function<void()> f) { onDisc = f; }
+  std::function<void()> onDisc;
+  ~AsyncWebServerRequest() { if (onDisc) onDisc(); delete sent; }
+};
+typedef std::function<void(AsyncWebServerRequest*)> ArRequestHandlerFunction;
+
+class AsyncWebServer {
+public:
+  explicit AsyncWebServer(uint16_t) {}
+  struct Route { String uri; ArRequestHandlerFunction fn; };
+  AsyncWebServer& on(const char* uri, WebRequestMethodComposite, ArRequestHandlerFunction fn) { routes.push_back({uri, fn}); return *this; }
+  void addHandler(AsyncWebHandler* h) { handlers.push_back(h); }
+  void begin() {}
+  // Mirrors AsyncCallbackWebHandler::canHandle(): exact match or "<uri>/..." prefix, first registered wins.
+  bool hostRequest(AsyncWebServerRequest& r) {
+    for (auto& rt : routes) {
+      if (rt.uri == r.url() || (rt.uri.length() > 1 && r.url().startsWith(rt.uri + "/"))) { rt.fn(&r); return true; }
+    }
+    return false;
+  }
+  std::vector<Route> routes;
+  std::vector<AsyncWebHandler*> handlers;
+};
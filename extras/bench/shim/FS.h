@@ -0,0 +1,42 @@
+#pragma once
+#include <Arduino.h>
+#include <stdio.h>
+#include <memory>
+#include <sys/stat.h>
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+extern size_t g_hostFsWrites, g_hostFsOpens;
+namespace fs {
+class File {
+public:
+  File() {}
+  explicit File(FILE* f) : _f(std::shared_ptr<FILE>(f, [](FILE* p){ if (p) fclose(p); })) {}
+  explicit operator bool() const { return (bool)_f; }
+  size_t write(const uint8_t* b, size_t n) { if (!_f) return 0; g_hostFsWrites++; return fwrite(b, 1, n, _f.get()); }
+  size_t size() { if (!_f) return 0; long p = ftell(_f.get()); fseek(_f.get(), 0, SEEK_END); long e = ftell(_f.get()); fseek(_f.get(), p, SEEK_SET); return (size_t)e; }
+  int read(uint8_t* b, size_t n) { return _f ? (int)fread(b, 1, n, _f.get()) : -1; }
+  int available() { if (!_f) return 0; long p = ftell(_f.get()); return (int)(size() - p); }
+  bool seek(size_t pos) { return _f && fseek(_f.get(), (long)pos, SEEK_SET) == 0; }
+  size_t position() { return _f ? (size_t)ftell(_f.get()) : 0; }
+  void flush() { if (_f) fflush(_f.get()); }
+  void close() { _f.reset(); }
+private:
+  std::shared_ptr<FILE> _f;
+};
+class FS {
+public:
+  explicit FS(const char* root) : _root(root) {}
+  File open(const char* p, const char* mode = FILE_READ, bool create = false) { (void)create; g_hostFsOpens++; return File(fopen(full(p).c_str(), mode)); }
+  File open(const String& p, const char* mode = FILE_READ, bool create = false) { return open(p.c_str(), mode, create); }
+  bool exists(const String& p) { struct stat st; return stat(full(p.c_str()).c_str(), &st) == 0; }
+  bool exists(const char* p) { return exists(String(p)); }
+  bool remove(const String& p) { return ::remove(full(p.c_str()).c_str()) == 0; }
+  bool rename(const String& a, const String& b) { return ::rename(full(a.c_str()).c_str(), full(b.c_str()).c_str()) == 0; }
+private:
+  std::string full(const char* p) const { return std::string(_root) + p; }
+  const char* _root;
+};
+}
+using fs::File;
+using fs::FS;
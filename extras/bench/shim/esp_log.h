@@ -0,0 +1,20 @@
+#pragma once
+#include <stdarg.h>
+#include <stdint.h>
+typedef enum { ESP_LOG_NONE, ESP_LOG_ERROR, ESP_LOG_WARN, ESP_LOG_INFO, ESP_LOG_DEBUG, ESP_LOG_VERBOSE } esp_log_level_t;
+typedef int (*vprintf_like_t)(const char*, va_list);
+vprintf_like_t esp_log_set_vprintf(vprintf_like_t f);
+void esp_log_level_set(const char* tag, esp_log_level_t level);
+void esp_log_write(esp_log_level_t level, const char* tag, const char* fmt, ...);
+uint32_t esp_log_timestamp(void);
+#define LOG_COLOR_E "\033[0;31m"
+#define LOG_COLOR_W "\033[0;33m"
+#define LOG_COLOR_I "\033[0;32m"
+#define LOG_COLOR_D
+#define LOG_COLOR_V
+#define LOG_RESET_COLOR "\033[0m"
+#define LOG_FORMAT(letter, format) LOG_COLOR_ ## letter #letter " (%u) %s: " format LOG_RESET_COLOR "\n"
+#define ESP_LOGE(tag, format, ...) esp_log_write(ESP_LOG_ERROR, tag, LOG_FORMAT(E, format), esp_log_timestamp(), tag, ##__VA_ARGS__)
+#define ESP_LOGW(tag, format, ...) esp_log_write(ESP_LOG_WARN, tag, LOG_FORMAT(W, format), esp_log_timestamp(), tag, ##__VA_ARGS__)
+#define ESP_LOGI(tag, format, ...) esp_log_write(ESP_LOG_INFO, tag, LOG_FORMAT(I, format), esp_log_timestamp(), tag, ##__VA_ARGS__)
+#define ESP_LOGD(tag, format, ...) esp_log_write(ESP_LOG_DEBUG, tag, LOG_FORMAT(D, format), esp_log_timestamp(), tag, ##__VA_ARGS__)
@@ -0,0 +1,34 @@
+#pragma once
+#include <stdint.h>
+#include <stddef.h>
+typedef int BaseType_t;
+typedef unsigned UBaseType_t;
+typedef uint32_t TickType_t;
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define portMAX_DELAY 0xFFFFFFFFu
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define portTICK_PERIOD_MS 1
+#define tskNO_AFFINITY 0x7FFFFFFF
+#define configMAX_PRIORITIES 25
+#define portNUM_PROCESSORS 2
+typedef struct HostMux { volatile int owner; volatile int count; } portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED { -1, 0 }
+void vPortEnterCritical(portMUX_TYPE*);
+void vPortExitCritical(portMUX_TYPE*);
+#define portENTER_CRITICAL(m) vPortEnterCritical(m)
+#define portEXIT_CRITICAL(m) vPortExitCritical(m)
+#define portENTER_CRITICAL_ISR(m) vPortEnterCritical(m)
+#define portEXIT_CRITICAL_ISR(m) vPortExitCritical(m)
+#define portENTER_CRITICAL_SAFE(m) vPortEnterCritical(m)
+#define portEXIT_CRITICAL_SAFE(m) vPortExitCritical(m)
+// Local interrupt mask: the host has no interrupts, one global lock stands in
+#define portSET_INTERRUPT_MASK_FROM_ISR() (vPortEnterCritical(nullptr), 0u)
+#define portCLEAR_INTERRUPT_MASK_FROM_ISR(x) ((void)(x), vPortExitCritical(nullptr))
+#define portYIELD_FROM_ISR(...) do{}while(0)
+BaseType_t xPortInIsrContext(void);
+BaseType_t xPortGetCoreID(void);
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
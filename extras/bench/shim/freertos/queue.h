@@ -0,0 +1,12 @@
+#pragma once
+#include "freertos/FreeRTOS.h"
+typedef struct HostQueue* QueueHandle_t;
+typedef QueueHandle_t SemaphoreHandle_t;
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item);
+void vQueueDelete(QueueHandle_t q);
+BaseType_t xQueueSend(QueueHandle_t q, const void* item, TickType_t wait);
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void* item, BaseType_t* hpw);
+BaseType_t xQueueReceive(QueueHandle_t q, void* item, TickType_t wait);
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q);
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q);
+#define xQueueSendToBack xQueueSend
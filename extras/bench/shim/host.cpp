@@ -0,0 +1,162 @@
+// Host implementations of the FreeRTOS / ESP-IDF / AsyncWebSocket shims:
+// tasks are threads, queues keep their items in one preallocated block (so
+// they don't show up in the bench's allocation count).
+#include <Arduino.h>
+#include <ESPAsyncWebServer.h>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <deque>
+#include <vector>
+#include <atomic>
+
+HostSerial Serial;
+EspClass ESP;
+uint32_t EspClass::getFreeHeap() { return 200 * 1024; }
+uint32_t EspClass::getMinFreeHeap() { return 180 * 1024; }
+void delay(uint32_t ms) { std::this_thread::sleep_for(std::chrono::milliseconds(ms)); }
+
+thread_local bool g_hostInIsr = false;
+thread_local int g_hostCore = 0;
+BaseType_t xPortInIsrContext(void) { return g_hostInIsr; }
+BaseType_t xPortGetCoreID(void) { return g_hostCore; }
+
+static std::recursive_mutex g_crit;
+void vPortEnterCritical(portMUX_TYPE*) { g_crit.lock(); }
+void vPortExitCritical(portMUX_TYPE*) { g_crit.unlock(); }
+
+struct TaskExit {};
+struct HostTask { std::thread th; const char* name; UBaseType_t prio; std::mutex m; std::condition_variable cv; uint32_t notify = 0; };
+thread_local HostTask* g_self = nullptr;
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char* name, uint32_t, void* arg, UBaseType_t prio, TaskHandle_t* out, BaseType_t) {
+  auto* t = new HostTask(); t->name = name; t->prio = prio;
+  std::mutex startM; std::condition_variable startCv; bool started = false;
+  if (out) *out = t;
+  t->th = std::thread([=, &startM, &startCv, &started]{
+    g_self = t;
+    { std::lock_guard<std::mutex> l(startM); started = true; } startCv.notify_one();
+    try { fn(arg); } catch (TaskExit&) {}
+  });
+  t->th.detach();
+  std::unique_lock<std::mutex> l(startM); startCv.wait(l, [&]{ return started; });
+  return pdPASS;
+}
+BaseType_t xTaskCreate(TaskFunction_t fn, const char* name, uint32_t st, void* arg, UBaseType_t prio, TaskHandle_t* out) { return xTaskCreatePinnedToCore(fn, name, st, arg, prio, out, tskNO_AFFINITY); }
+void vTaskDelete(TaskHandle_t t) { if (!t || t == g_self) throw TaskExit(); /* host: cannot kill foreign threads */ }
+void vTaskDelay(TickType_t ticks) { std::this_thread::sleep_for(std::chrono::milliseconds(ticks)); if (!ticks) std::this_thread::yield(); }
+TickType_t xTaskGetTickCount(void) { return millis(); }
+TaskHandle_t xTaskGetCurrentTaskHandle(void) { return g_self; }
+UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t) { return 1024; }
+const char* pcTaskGetName(TaskHandle_t t) { return t ? t->name : "main"; }
+UBaseType_t uxTaskPriorityGet(TaskHandle_t t) { return t ? t->prio : 1; }
+BaseType_t xTaskNotifyGive(TaskHandle_t t) { { std::lock_guard<std::mutex> l(t->m); t->notify++; } t->cv.notify_one(); return pdPASS; }
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t wait) {
+  HostTask* t = g_self; std::unique_lock<std::mutex> l(t->m);
+  auto pred = [&]{ return t->notify > 0; };
+  if (wait == portMAX_DELAY) t->cv.wait(l, pred); else t->cv.wait_for(l, std::chrono::milliseconds(wait), pred);
+  uint32_t v = t->notify; if (clear) t->notify = 0; else if (v) t->notify--; return v;
+}
+
+struct HostQueue {
+  std::mutex m; std::condition_variable cv;
+  std::vector<uint8_t> store; size_t cap = 0, item = 0, head = 0, count = 0;
+  std::timed_mutex tm; // semaphores
+};
+QueueHandle_t xQueueCreate(UBaseType_t len, UBaseType_t item) { auto* q = new HostQueue(); q->cap = len; q->item = item; q->store.resize(len * item); return q; }
+void vQueueDelete(QueueHandle_t q) { delete q; }
+template <class Pred>
+static bool hostWait(HostQueue* q, std::unique_lock<std::mutex>& l, TickType_t wait, Pred pred) {
+  if (pred()) return true;
+  if (!wait) return false;
+  if (wait == portMAX_DELAY) { q->cv.wait(l, pred); return true; }
+  return q->cv.wait_for(l, std::chrono::milliseconds(wait), pred);
+}
+BaseType_t xQueueSend(QueueHandle_t q, const void* it, TickType_t wait) {
+  std::unique_lock<std::mutex> l(q->m);
+  if (!hostWait(q, l, wait, [&]{ return q->count < q->cap; })) return pdFALSE;
+  memcpy(&q->store[((q->head + q->count) % q->cap) * q->item], it, q->item);
+  q->count++;
+  q->cv.notify_all();
+  return pdTRUE;
+}
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void* it, BaseType_t* hpw) { if (hpw) *hpw = pdFALSE; return xQueueSend(q, it, 0); }
+BaseType_t xQueueReceive(QueueHandle_t q, void* it, TickType_t wait) {
+  std::unique_lock<std::mutex> l(q->m);
+  if (!hostWait(q, l, wait, [&]{ return q->count > 0; })) return pdFALSE;
+  memcpy(it, &q->store[q->head * q->item], q->item);
+  q->head = (q->head + 1) % q->cap;
+  q->count--;
+  q->cv.notify_all();
+  return pdTRUE;
+}
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) { std::lock_guard<std::mutex> l(q->m); return q->count; }
+UBaseType_t uxQueueSpacesAvailable(QueueHandle_t q) { std::lock_guard<std::mutex> l(q->m); return q->cap - q->count; }
+SemaphoreHandle_t xSemaphoreCreateMutex(void) { return new HostQueue(); }
+void vSemaphoreDelete(SemaphoreHandle_t s) { delete s; }
+BaseType_t xSemaphoreTake(SemaphoreHandle_t s, TickType_t wait) {
+  if (wait == portMAX_DELAY) { s->tm.lock(); return pdTRUE; }
+  return s->tm.try_lock_for(std::chrono::milliseconds(wait)) ? pdTRUE : pdFALSE;
+}
+BaseType_t xSemaphoreGive(SemaphoreHandle_t s) { s->tm.unlock(); return pdTRUE; }
+
+static vprintf_like_t g_vprintf = [](const char* f, va_list ap){ return vprintf(f, ap); };
+vprintf_like_t esp_log_set_vprintf(vprintf_like_t f) { auto o = g_vprintf; g_vprintf = f; return o; }
+void esp_log_level_set(const char*, esp_log_level_t) {}
+uint32_t esp_log_timestamp(void) { return millis(); }
+void esp_log_write(esp_log_level_t, const char*, const char* fmt, ...) { va_list ap; va_start(ap, fmt); g_vprintf(fmt, ap); va_end(ap); }
+
+// --- AsyncWebSocket fake ---
+bool AsyncWebSocketClient::canSend() const { std::lock_guard<std::recursive_mutex> l(_server->lock); return queue.size() < maxQueue; }
+size_t AsyncWebSocketClient::queueLen() const { std::lock_guard<std::recursive_mutex> l(_server->lock); return queue.size(); }
+bool AsyncWebSocketClient::_pushShared(bool bin, std::shared_ptr<std::vector<uint8_t>> d) {
+  std::lock_guard<std::recursive_mutex> l(_server->lock);
+  if (queue.size() >= maxQueue) return false;
+  queue.push_back({bin, d}); return true;
+}
+size_t AsyncWebSocketClient::drain(size_t maxFrames, const std::function<void(const HostFrame&)>& fn) {
+  size_t n = 0;
+  for (; n < maxFrames; n++) {
+    HostFrame f;
+    {
+      std::lock_guard<std::recursive_mutex> l(_server->lock);
+      if (queue.empty()) break;
+      f = std::move(queue.front());
+      queue.pop_front();
+    }
+    fn(f);
+  }
+  return n;
+}
+size_t AsyncWebSocketClient::queuedBytes() const { std::lock_guard<std::recursive_mutex> l(_server->lock); size_t n = 0; for (auto& f : queue) n += f.data->size(); return n; }
+size_t AsyncClient::space() const { size_t q = _c->queuedBytes(); return q >= sndBuf ? 0 : sndBuf - q; }
+void AsyncWebSocketClient::close(uint16_t, const char*) {}
+size_t AsyncWebSocket::count() const { std::lock_guard<std::recursive_mutex> l(const_cast<AsyncWebSocket*>(this)->lock); return clients.size(); }
+AsyncWebSocketClient* AsyncWebSocket::client(uint32_t id) { std::lock_guard<std::recursive_mutex> l(lock); for (auto& c : clients) if (c.id() == id) return &c; return nullptr; }
+bool AsyncWebSocket::availableForWriteAll() { std::lock_guard<std::recursive_mutex> l(lock); for (auto& c : clients) if (!c.canSend()) return false; return true; }
+void AsyncWebSocket::textAll(AsyncWebSocketMessageBuffer* b) { std::lock_guard<std::recursive_mutex> l(lock); for (auto& c : clients) c._pushShared(false, b->_buf); delete b; }
+void AsyncWebSocket::textAll(const char* m, size_t n) { auto* b = new AsyncWebSocketMessageBuffer(n); memcpy(b->get(), m, n); textAll(b); }
+void AsyncWebSocket::binaryAll(AsyncWebSocketMessageBuffer* b) { std::lock_guard<std::recursive_mutex> l(lock); for (auto& c : clients) c._pushShared(true, b->_buf); delete b; }
+void AsyncWebSocket::binaryAll(const uint8_t* m, size_t n) { auto* b = new AsyncWebSocketMessageBuffer(n); memcpy(b->get(), m, n); binaryAll(b); }
+AsyncWebSocketClient* AsyncWebSocket::hostConnect(void* req) {
+  AsyncWebSocketClient* c;
+  { std::lock_guard<std::recursive_mutex> l(lock); clients.emplace_back(this, _nextId++); c = &clients.back(); }
+  if (_h) _h(this, c, WS_EVT_CONNECT, req, nullptr, 0);
+  return c;
+}
+void AsyncWebSocket::hostDisconnect(uint32_t id) {
+  AsyncWebSocketClient* c = client(id);
+  if (!c) return;
+  if (_h) _h(this, c, WS_EVT_DISCONNECT, nullptr, nullptr, 0);
+  std::lock_guard<std::recursive_mutex> l(lock);
+  clients.remove_if([&](AsyncWebSocketClient& x){ return x.id() == id; });
+}
+void AsyncWebSocket::hostSend(uint32_t id, const char* text, bool binary, size_t len) {
+  AsyncWebSocketClient* c = client(id);
+  if (!c || !_h) return;
+  if (len == (size_t)-1) len = strlen(text);
+  AwsFrameInfo info{}; info.final = 1; info.index = 0; info.len = len; info.opcode = binary ? WS_BINARY : WS_TEXT;
+  _h(this, c, WS_EVT_DATA, &info, (uint8_t*)text, len);
+}
+#include <FS.h>
+size_t g_hostFsWrites = 0, g_hostFsOpens = 0;
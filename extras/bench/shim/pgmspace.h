@@ -0,0 +1,5 @@
+#pragma once
+#include <string.h>
+#define strlen_P strlen
+#define memcpy_P memcpy
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
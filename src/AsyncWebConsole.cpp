@@ -1,5 +1,7 @@
 #include "AsyncWebConsole.h"
 #include <stdarg.h>
+#include <memory>
+#include <new>
 #include "freertos/portmacro.h"
 
 #include <FS.h>
@@ -20,8 +22,54 @@ extern "C" void ets_install_putc1(void (*func)(char));
 #include <SPIFFS.h>
 #define AWC_HAS_SPIFFS 1
 #endif
+#if __has_include(<esp_memory_utils.h>)
+#include <esp_memory_utils.h>    // IDF 5.x: esp_ptr_in_drom()
+#define AWC_HAVE_PTR_IN_DROM 1
+#elif __has_include(<soc/soc_memory_layout.h>)
+#include <soc/soc_memory_layout.h>
+#define AWC_HAVE_PTR_IN_DROM 1
+#endif
+#if __has_include(<esp_heap_caps.h>)
+#include <esp_heap_caps.h>
+#define AWC_HAVE_HEAP_CAPS 1
+#endif
+#if __has_include(<AsyncUDP.h>)
+#include <AsyncUDP.h>
+#define AWC_HAVE_ASYNCUDP 1
+#endif
+#if __has_include(<WiFi.h>)
+#include <WiFi.h>
+#define AWC_HAVE_WIFI 1
+#endif
+#if __has_include(<esp32-hal-timer.h>)
+#define AWC_HAVE_HWTIMER 1       // Arduino timer API (awcbench --isr)
+#endif
+#if __has_include(<esp_random.h>)
+#include <esp_random.h>          // IDF 5.x: esp_random()
+#define AWC_HAVE_ESP_RANDOM 1
+#elif __has_include(<esp_system.h>)
+#include <esp_system.h>
+#define AWC_HAVE_ESP_RANDOM 1
+#endif
+#if __has_include(<esp_system.h>)
+#include <esp_system.h>          // esp_reset_reason() for the crash log banner
+#define AWC_HAVE_RESET_REASON 1
+#endif
+#if AWC_CRASHLOG_BYTES && __has_include(<esp_attr.h>)
+#include <esp_attr.h>
+#endif
+#ifndef AWC_CRASHLOG_ATTR
+#define AWC_CRASHLOG_ATTR RTC_NOINIT_ATTR
+#endif
+
+// Task/ISR-agnostic critical section (older cores lack the _SAFE variants)
+#ifndef portENTER_CRITICAL_SAFE
+#define portENTER_CRITICAL_SAFE(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_SAFE(mux)  portEXIT_CRITICAL(mux)
+#endif
 
-AsyncWebConsole* AsyncWebConsole::_sink = nullptr;
+AsyncWebConsole* volatile AsyncWebConsole::_bridges[AsyncWebConsole::kMaxBridges] = {};
+AsyncWebConsole* AsyncWebConsole::_etsSink = nullptr;
 vprintf_like_t   AsyncWebConsole::_origVprintf = nullptr;
 AsyncWebConsole::putc1_t AsyncWebConsole::_origPutc1 = nullptr;
 
@@ -30,10 +78,35 @@ AsyncWebConsole::putc1_t AsyncWebConsole::_origPutc1 = nullptr;
 const char AsyncWebConsole::_defaultIndexHtml[] PROGMEM =
 #include "../web/console.html"
 ;
+#include "../web/console_html_gz.h"
 
 static const char* TAG = "AsyncWebConsole";
 
 // helpers
+// Allocate with the given heap caps (e.g. MALLOC_CAP_SPIRAM); nullptr when the
+// caps cannot be satisfied. Memory is released with free() either way.
+static void* _capsMallocStrict(size_t n, uint32_t caps) {
+#if AWC_HAVE_HEAP_CAPS
+  return caps ? heap_caps_malloc(n, caps) : nullptr;
+#else
+  (void)n; (void)caps;
+  return nullptr;
+#endif
+}
+
+// Same, falling back to the default heap
+static void* _capsMalloc(size_t n, uint32_t caps) {
+  void* p = _capsMallocStrict(n, caps);
+  return p ? p : malloc(n);
+}
+
+// Ticks until data buffered at firstMs is maxAgeMs old (at least one)
+static TickType_t _ticksUntil(uint32_t firstMs, uint32_t maxAgeMs) {
+  uint32_t age = millis() - firstMs;
+  TickType_t due = age >= maxAgeMs ? 1 : pdMS_TO_TICKS(maxAgeMs - age);
+  return due ? due : 1;
+}
+
 static char * _vsformat(const char* fmt, size_t maxLen, va_list ap) {
   va_list ap2; va_copy(ap2, ap);
   int n = vsnprintf(nullptr, 0, fmt, ap2);
@@ -50,7 +123,432 @@ static char * _vsformat(const char* fmt, size_t maxLen, va_list ap) {
   return p;
 }
 
-bool AsyncWebConsole::_inIsr() {
+// Backlog record header: kRecMark, millis() at enqueue as 6 chars of 6 bits
+// ('0' based, so never '\n') and a flags char ('0' + ESP_LOG_* level, +8 for
+// lines from the esp_log bridge, +16 when logged on core 1). Text clients get
+// it as "[HH:MM:SS.mmm] ", binary clients as a timestamp delta and flags byte.
+static constexpr char   kRecMark   = '\x1f';
+static constexpr size_t kRecHdrLen = 8;
+
+static void _recHeader(char* out, uint32_t ms, uint8_t level, bool fromIdf, uint8_t core = 0) {
+  out[0] = kRecMark;
+  for (int i = 0; i < 6; i++) out[1 + i] = static_cast<char>('0' + ((ms >> (6 * (5 - i))) & 0x3F));
+  out[7] = static_cast<char>('0' + (level & 7) + (fromIdf ? 8 : 0) + (core ? 16 : 0));
+}
+
+static bool _recParse(const char* h, uint32_t& ms, uint8_t& level, bool* fromIdf = nullptr, uint8_t* core = nullptr) {
+  if (h[0] != kRecMark) return false;
+  ms = 0;
+  for (int i = 0; i < 6; i++) ms = (ms << 6) | static_cast<uint32_t>((h[1 + i] - '0') & 0x3F);
+  level = static_cast<uint8_t>((h[7] - '0') & 7);
+  if (fromIdf) *fromIdf = ((h[7] - '0') & 8) != 0;
+  if (core) *core = ((h[7] - '0') & 16) ? 1 : 0;
+  return true;
+}
+
+// Crash log: a tail ring of backlog records in memory the startup code
+// leaves alone. wpos is written after the data and wposInv after wpos, so a
+// reset between any two stores still validates (at worst the oldest line is
+// torn, and it is skipped); garbage after a power cycle fails the magic.
+// Each record carries its length and a CRC, so a partly overwritten region
+// (brownout, another no-init user) loses only the damaged records.
+#if AWC_CRASHLOG_BYTES
+static constexpr uint32_t kCrashMagic = 0x41574332; // "AWC2"
+struct AwcCrashLog {
+  uint32_t magic;
+  uint32_t size;
+  uint32_t wpos;     // absolute count of bytes written
+  uint32_t wposInv;  // ~wpos
+  char     data[AWC_CRASHLOG_BYTES];
+};
+static AWC_CRASHLOG_ATTR AwcCrashLog s_crashLog;
+static bool s_crashOwned = false;
+
+// Record: backlog header, then kCrashTagLen chars (length in 3, CRC-24 of
+// header and line in 4), '0' based like the header so never '\n' or kRecMark
+static constexpr size_t kCrashTagLen = 7;
+
+// CRC-32 (reflected 0xEDB88320) with a nibble table
+static uint32_t _crashCrc(uint32_t crc, const char* s, size_t n) {
+  static const uint32_t t[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  for (size_t i = 0; i < n; i++) {
+    crc ^= static_cast<uint8_t>(s[i]);
+    crc = (crc >> 4) ^ t[crc & 15];
+    crc = (crc >> 4) ^ t[crc & 15];
+  }
+  return crc;
+}
+
+// CRC over n ring bytes at absolute position w
+static uint32_t _crashCrcAt(uint32_t crc, uint32_t w, size_t n) {
+  size_t at = w % AWC_CRASHLOG_BYTES;
+  size_t first = min(n, static_cast<size_t>(AWC_CRASHLOG_BYTES) - at);
+  crc = _crashCrc(crc, s_crashLog.data + at, first);
+  return first < n ? _crashCrc(crc, s_crashLog.data, n - first) : crc;
+}
+
+static void _crashWrite(uint32_t w, const char* s, size_t n) {
+  if (n > AWC_CRASHLOG_BYTES) { w += n - AWC_CRASHLOG_BYTES; s += n - AWC_CRASHLOG_BYTES; n = AWC_CRASHLOG_BYTES; }
+  size_t at = w % AWC_CRASHLOG_BYTES;
+  size_t first = min(n, static_cast<size_t>(AWC_CRASHLOG_BYTES) - at);
+  memcpy(s_crashLog.data + at, s, first);
+  if (first < n) memcpy(s_crashLog.data, s + first, n - first);
+}
+
+static const char* _resetReasonName() {
+#if AWC_HAVE_RESET_REASON
+  switch (esp_reset_reason()) {
+    case ESP_RST_SW:        return "software reset";
+    case ESP_RST_PANIC:     return "panic";
+    case ESP_RST_INT_WDT:   return "interrupt watchdog";
+    case ESP_RST_TASK_WDT:  return "task watchdog";
+    case ESP_RST_WDT:       return "watchdog";
+    case ESP_RST_BROWNOUT:  return "brownout";
+    case ESP_RST_DEEPSLEEP: return "deep sleep wake";
+    case ESP_RST_EXT:       return "external reset";
+    default:                return "reset";
+  }
+#else
+  return "reset";
+#endif
+}
+#endif
+
+// Repeat detection: FNV-1a of the line without the "(ticks)" of an IDF prefix
+static uint32_t _repeatHash(const char* s, size_t n) {
+  size_t i = 0, skip = 0, resume = 0;
+  if (n > 2 && s[0] == '\x1b' && s[1] == '[') {
+    for (size_t k = 2; k < 12 && k < n; k++) {
+      if (s[k] == 'm') { i = k + 1; break; }
+    }
+  }
+  if (i + 3 <= n && s[i + 1] == ' ' && s[i + 2] == '(') {
+    const char* r = static_cast<const char*>(memchr(s + i + 3, ')', min(n - i - 3, static_cast<size_t>(24))));
+    if (r) { skip = i + 3; resume = static_cast<size_t>(r - s); }
+  }
+  uint32_t h = 2166136261U;
+  for (size_t k = 0; k < n; k++) {
+    if (k == skip && resume) k = resume;
+    h ^= static_cast<uint8_t>(s[k]);
+    h *= 16777619U;
+  }
+  return h;
+}
+
+static size_t _fmtTimestamp(uint32_t ms, char* out, size_t cap) {
+  uint32_t sec = ms / 1000U;
+  uint32_t h = (sec / 3600U) % 100U; // wrap at 99h
+  uint32_t m = (sec / 60U) % 60U;
+  uint32_t s = sec % 60U;
+  uint32_t mm = ms % 1000U;
+  int n = snprintf(out, cap, "[%02u:%02u:%02u.%03u] ", (unsigned)h, (unsigned)m, (unsigned)s, (unsigned)mm);
+  return n > 0 ? min(static_cast<size_t>(n), cap - 1) : 0;
+}
+
+// Latency histogram bucket limits (the last bucket is open-ended)
+static const uint32_t kLatencyBoundsUs[AsyncWebConsole::kLatencyBuckets - 1] = {
+  100, 1000, 5000, 10000, 50000, 100000, 500000
+};
+
+static String _statsText(const AsyncWebConsole::Stats& st){
+  char buf[560];
+  int n = snprintf(buf, sizeof(buf),
+    "lines     %u (%u bytes), enqueued %u, filtered %u, repeats folded %u\n"
+    "dropped   queue %u, no memory %u, rate limit %u\n"
+    "skipped   backlog evicted %u, ws %u, sinks %u bytes; file %u bytes, syslog %u datagrams\n"
+    "queue     %u waiting, high %u\n"
+    "latency   max %u us; <0.1ms %u, <1ms %u, <5ms %u, <10ms %u, <50ms %u, <100ms %u, <500ms %u, more %u\n",
+    (unsigned)st.lines, (unsigned)st.bytes, (unsigned)st.enqueued, (unsigned)st.filtered, (unsigned)st.repeated,
+    (unsigned)st.droppedQueue, (unsigned)st.droppedNoMem, (unsigned)st.rateLimited,
+    (unsigned)st.backlogEvicted, (unsigned)st.wsSkipped, (unsigned)st.sinkSkipped,
+    (unsigned)st.fileDropped, (unsigned)st.udpDropped,
+    (unsigned)st.queueDepth, (unsigned)st.queueHigh,
+    (unsigned)st.latencyMaxUs, (unsigned)st.latency[0], (unsigned)st.latency[1], (unsigned)st.latency[2],
+    (unsigned)st.latency[3], (unsigned)st.latency[4], (unsigned)st.latency[5], (unsigned)st.latency[6],
+    (unsigned)st.latency[7]);
+  return n > 0 ? String(buf) : String();
+}
+
+// Binary frames: [kBinVersion | kBinTimestamps] then records of
+// [flags][varint ts delta][varint len][len bytes, no '\n']. flags carries the
+// ESP_LOG_* level in bits 0-2, kBinIdf / kBinCore1 from the record header,
+// kBinColored when the IDF color escape was stripped (the viewer re-applies
+// it from the level) and kBinSys for notices.
+// Timestamp deltas are relative to the previous record in the same frame.
+static constexpr uint8_t kBinVersion    = 0x01;
+static constexpr uint8_t kBinTimestamps = 0x80;
+static constexpr uint8_t kBinColored    = 0x40;
+static constexpr uint8_t kBinSys        = 0x80;
+static constexpr uint8_t kBinMark       = 0x20;
+static constexpr uint8_t kBinCore1      = 0x10;
+static constexpr uint8_t kBinIdf        = 0x08;
+
+// Resume mark for clients that connected with ?resume: "EEEEEEEE:PPPPPPPP"
+// (boot epoch, backlog position after the frame), sent back as ?since= on
+// reconnect. Text frames start with kMarkChar + mark + '\n', binary frames
+// with a kBinMark record.
+static constexpr char   kMarkChar = '\x1e';
+static constexpr size_t kMarkLen  = 17;
+
+// Channel frames (addChannel) start with kChanMark + '0' + channel id, then
+// the usual text or binary frame
+static constexpr char   kChanMark = '\x1d';
+
+static void _fmtMark(char* out, uint32_t epoch, uint32_t pos) {
+  static const char hex[] = "0123456789abcdef";
+  for (int i = 0; i < 8; i++) {
+    out[i]     = hex[(epoch >> (28 - 4 * i)) & 0xF];
+    out[9 + i] = hex[(pos >> (28 - 4 * i)) & 0xF];
+  }
+  out[8] = ':';
+}
+
+static size_t _putVarint(char* out, uint32_t v) {
+  size_t n = 0;
+  do {
+    uint8_t b = v & 0x7F;
+    v >>= 7;
+    if (v) b |= 0x80;
+    if (out) out[n] = static_cast<char>(b);
+    n++;
+  } while (v);
+  return n;
+}
+
+// LZ-compressed binary frames: [kBinVersionLz | kBinTimestamps][varint raw len]
+// then an LZ4-style block of the v1 record stream. Sequences are a token byte
+// (literal count << 4 | match length - 4, 15 = extended by 255-runs), the
+// literals, and a 16-bit LE offset back into "dictionary + output so far"; the
+// last sequence has literals only. The static dictionary primes each frame with
+// common IDF fragments (keep in sync with web/console.html).
+static constexpr uint8_t kBinVersionLz = 0x02;
+static const char kLzDict[] =
+  "E (W (I (D (V () wifi:) phy_init: ) cpu_start: ) heap_init: ) system_api: "
+  ") esp_netif_handlers: sta ip: , mask: , gw: ) HTTP_CLIENT: ) httpd: ) event: "
+  "connected disconnected reason: state: -> failed error timeout Free heap: "
+  "[AsyncWebConsole] skipped  bytes";
+static constexpr size_t kLzDictLen = sizeof(kLzDict) - 1;
+static constexpr size_t kLzHashBits = 10;
+static constexpr uint16_t kLzEmpty = 0xFFFF;
+
+static inline uint32_t _lzRead32(const uint8_t* p) {
+  uint32_t v; memcpy(&v, p, 4); return v;
+}
+static inline uint32_t _lzHash(uint32_t v) {
+  return (v * 2654435761U) >> (32 - kLzHashBits);
+}
+static size_t _lzPutLen(uint8_t* out, size_t n) {
+  size_t k = 0;
+  while (n >= 255) { out[k++] = 255; n -= 255; }
+  out[k++] = static_cast<uint8_t>(n);
+  return k;
+}
+static size_t _lzEmit(uint8_t* out, const uint8_t* lit, size_t litLen, size_t matchLen, size_t off) {
+  size_t k = 0;
+  uint8_t* token = out + k++;
+  *token = static_cast<uint8_t>((litLen < 15 ? litLen : 15) << 4);
+  if (litLen >= 15) k += _lzPutLen(out + k, litLen - 15);
+  memcpy(out + k, lit, litLen);
+  k += litLen;
+  if (matchLen) {
+    out[k++] = static_cast<uint8_t>(off & 0xFF);
+    out[k++] = static_cast<uint8_t>(off >> 8);
+    size_t m = matchLen - 4;
+    *token |= static_cast<uint8_t>(m < 15 ? m : 15);
+    if (m >= 15) k += _lzPutLen(out + k, m - 15);
+  }
+  return k;
+}
+static size_t _lzBound(size_t n) { return n + n / 255 + 16; }
+
+// Greedy single-probe LZ over base[start, end); base[0, start) is the window
+// prefix (dictionary). table holds 1 << kLzHashBits positions.
+static size_t _lzCompress(const uint8_t* base, size_t start, size_t end, uint8_t* out, uint16_t* table) {
+  for (size_t i = 0; i < (1u << kLzHashBits); i++) table[i] = kLzEmpty;
+  for (size_t i = 0; i + 4 <= start; i++) table[_lzHash(_lzRead32(base + i))] = static_cast<uint16_t>(i);
+  size_t ip = start, anchor = start, k = 0;
+  while (ip + 4 <= end) {
+    uint32_t h = _lzHash(_lzRead32(base + ip));
+    size_t ref = table[h];
+    table[h] = static_cast<uint16_t>(ip);
+    if (ref != kLzEmpty && ip - ref <= 0xFFFF && _lzRead32(base + ref) == _lzRead32(base + ip)) {
+      size_t len = 4;
+      while (ip + len < end && base[ref + len] == base[ip + len]) len++;
+      k += _lzEmit(out + k, base + anchor, ip - anchor, len, ip - ref);
+      ip += len;
+      anchor = ip;
+    } else {
+      ip++;
+    }
+  }
+  k += _lzEmit(out + k, base + anchor, end - anchor, 0, 0);
+  return k;
+}
+
+// Deferred formatting: a record is [fmt pointer][uint16 args length][packed args],
+// where args follow the conversion order of fmt. %s strings are stored inline as
+// NUL-terminated copies. The drain task re-walks fmt and formats spec by spec.
+namespace {
+
+enum DeferArg : uint8_t { DA_NONE, DA_INT, DA_LONG, DA_LLONG, DA_PTR, DA_DOUBLE, DA_STR, DA_BAD };
+
+struct DeferSpec {
+  const char* start;  // points at '%'
+  size_t      len;    // length of the whole specification
+  uint8_t     stars;  // '*' width/precision arguments (ints) preceding the value
+  bool        precStar; // the last star is the precision
+  int         prec;   // fixed precision, -1 when none (or given by a star)
+  DeferArg    arg;
+};
+
+template <typename T> static DeferArg _deferIntArg() {
+  return sizeof(T) > sizeof(long) ? DA_LLONG : (sizeof(T) > sizeof(int) ? DA_LONG : DA_INT);
+}
+
+// Parse one conversion starting at '%'; returns pointer past it
+static const char* _deferParse(const char* p, DeferSpec& sp) {
+  sp.start = p++; sp.stars = 0; sp.precStar = false; sp.prec = -1; sp.arg = DA_BAD;
+  if (*p == '%') { sp.len = 2; sp.arg = DA_NONE; return p + 1; }
+  while (*p && strchr("-+ #0'", *p)) p++;
+  if (*p == '*') { sp.stars++; p++; } else while (*p >= '0' && *p <= '9') p++;
+  if (*p == '.') {
+    p++;
+    if (*p == '*') { sp.stars++; sp.precStar = true; p++; }
+    else { sp.prec = 0; while (*p >= '0' && *p <= '9') sp.prec = min(sp.prec * 10 + (*p++ - '0'), 0xFFFF); }
+  }
+  enum { LM_NONE, LM_L, LM_LL, LM_Z, LM_J, LM_T, LM_BIGL } lm = LM_NONE;
+  if (*p == 'h') { p++; if (*p == 'h') p++; }
+  else if (*p == 'l') { p++; lm = LM_L; if (*p == 'l') { p++; lm = LM_LL; } }
+  else if (*p == 'z') { p++; lm = LM_Z; }
+  else if (*p == 'j') { p++; lm = LM_J; }
+  else if (*p == 't') { p++; lm = LM_T; }
+  else if (*p == 'L' || *p == 'q') { p++; lm = LM_BIGL; }
+  char conv = *p;
+  if (conv) p++;
+  sp.len = static_cast<size_t>(p - sp.start);
+  switch (conv) {
+    case 'd': case 'i': case 'u': case 'x': case 'X': case 'o': case 'c':
+      switch (lm) {
+        case LM_NONE: sp.arg = DA_INT; break;
+        case LM_L:    sp.arg = _deferIntArg<long>(); break;
+        case LM_LL:   sp.arg = DA_LLONG; break;
+        case LM_Z:    sp.arg = _deferIntArg<size_t>(); break;
+        case LM_J:    sp.arg = _deferIntArg<intmax_t>(); break;
+        case LM_T:    sp.arg = _deferIntArg<ptrdiff_t>(); break;
+        default:      sp.arg = (conv == 'c') ? DA_INT : DA_LLONG; break;
+      }
+      if (conv == 'c' && lm != LM_NONE) sp.arg = DA_BAD; // wint_t
+      break;
+    case 'p': sp.arg = DA_PTR; break;
+    case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+      sp.arg = (lm == LM_BIGL) ? DA_BAD : DA_DOUBLE; break;
+    case 's': sp.arg = (lm == LM_NONE) ? DA_STR : DA_BAD; break;
+    default:  sp.arg = DA_BAD; break; // %n, wide strings, unknown
+  }
+  if (sp.len >= 24) sp.arg = DA_BAD; // must fit the render spec buffer
+  return p;
+}
+
+static size_t _deferArgSize(DeferArg a) {
+  switch (a) {
+    case DA_INT:    return sizeof(int);
+    case DA_LONG:   return sizeof(long);
+    case DA_LLONG:  return sizeof(long long);
+    case DA_PTR:    return sizeof(void*);
+    case DA_DOUBLE: return sizeof(double);
+    default:        return 0;
+  }
+}
+
+// Walk fmt/ap and either size (out == nullptr) or write the packed args.
+// Returns packed size, or 0 when the format cannot be deferred.
+static size_t _deferPack(const char* fmt, va_list ap, char* out, size_t strMax) {
+  size_t n = 0;
+  for (const char* p = fmt; *p; ) {
+    if (*p != '%') { p++; continue; }
+    DeferSpec sp;
+    p = _deferParse(p, sp);
+    if (sp.arg == DA_BAD) return 0;
+    if (sp.arg == DA_NONE) continue;
+    int prec = sp.prec;
+    for (uint8_t i = 0; i < sp.stars; i++) {
+      int v = va_arg(ap, int);
+      if (out) memcpy(out + n, &v, sizeof(v));
+      n += sizeof(v);
+      if (sp.precStar && i + 1 == sp.stars) prec = v; // negative: no precision
+    }
+    switch (sp.arg) {
+      case DA_INT:    { int v = va_arg(ap, int);             if (out) memcpy(out + n, &v, sizeof(v)); break; }
+      case DA_LONG:   { long v = va_arg(ap, long);           if (out) memcpy(out + n, &v, sizeof(v)); break; }
+      case DA_LLONG:  { long long v = va_arg(ap, long long); if (out) memcpy(out + n, &v, sizeof(v)); break; }
+      case DA_PTR:    { void* v = va_arg(ap, void*);         if (out) memcpy(out + n, &v, sizeof(v)); break; }
+      case DA_DOUBLE: { double v = va_arg(ap, double);       if (out) memcpy(out + n, &v, sizeof(v)); break; }
+      case DA_STR: {
+        const char* v = va_arg(ap, const char*);
+        if (!v) v = "(null)";
+        // Like vsnprintf, never read past the precision (buffers need no NUL)
+        size_t sl = strnlen(v, prec >= 0 ? min(static_cast<size_t>(prec), strMax) : strMax);
+        if (out) { memcpy(out + n, v, sl); out[n + sl] = '\0'; }
+        n += sl + 1;
+        continue;
+      }
+      default: break;
+    }
+    n += _deferArgSize(sp.arg);
+  }
+  return n;
+}
+
+// Format a deferred record into out (always NUL-terminated); returns length
+static size_t _deferRender(const char* rec, char* out, size_t cap) {
+  if (!cap) return 0;
+  const char* fmt; uint16_t argLen;
+  memcpy(&fmt, rec, sizeof(fmt));
+  memcpy(&argLen, rec + sizeof(fmt), sizeof(argLen));
+  const char* args = rec + sizeof(fmt) + sizeof(argLen);
+  const char* argEnd = args + argLen;
+
+  size_t o = 0;
+  char spec[24];
+  for (const char* p = fmt; *p && o + 1 < cap; ) {
+    if (*p != '%') { out[o++] = *p++; continue; }
+    DeferSpec sp;
+    p = _deferParse(p, sp);
+    if (sp.arg == DA_NONE) { out[o++] = '%'; continue; }
+    memcpy(spec, sp.start, sp.len);
+    spec[sp.len] = '\0';
+
+    int st[2] = {0, 0};
+    for (uint8_t i = 0; i < sp.stars; i++) { memcpy(&st[i], args, sizeof(int)); args += sizeof(int); }
+    char* dst = out + o;
+    size_t room = cap - o;
+    int w = 0;
+#define AWC_DEFER_EMIT(v) \
+    (sp.stars == 2 ? snprintf(dst, room, spec, st[0], st[1], v) : \
+     sp.stars == 1 ? snprintf(dst, room, spec, st[0], v) : snprintf(dst, room, spec, v))
+    switch (sp.arg) {
+      case DA_INT:    { int v;       memcpy(&v, args, sizeof(v)); w = AWC_DEFER_EMIT(v); break; }
+      case DA_LONG:   { long v;      memcpy(&v, args, sizeof(v)); w = AWC_DEFER_EMIT(v); break; }
+      case DA_LLONG:  { long long v; memcpy(&v, args, sizeof(v)); w = AWC_DEFER_EMIT(v); break; }
+      case DA_PTR:    { void* v;     memcpy(&v, args, sizeof(v)); w = AWC_DEFER_EMIT(v); break; }
+      case DA_DOUBLE: { double v;    memcpy(&v, args, sizeof(v)); w = AWC_DEFER_EMIT(v); break; }
+      case DA_STR:    { w = AWC_DEFER_EMIT(args); args += strlen(args) + 1; break; }
+      default: break;
+    }
+#undef AWC_DEFER_EMIT
+    args += _deferArgSize(sp.arg);
+    if (args > argEnd) break; // corrupted record; keep what we have
+    if (w > 0) o += min(static_cast<size_t>(w), room - 1);
+  }
+  out[o] = '\0';
+  return o;
+}
+
+} // namespace
+
+bool IRAM_ATTR AsyncWebConsole::_inIsr() {
 #if defined(ARDUINO_ARCH_ESP32)
   #ifdef portCHECK_IF_IN_ISR
     return portCHECK_IF_IN_ISR();
@@ -62,6 +560,40 @@ bool AsyncWebConsole::_inIsr() {
 #endif
 }
 
+// Mirror output and file logging, fed through the sink pipeline
+class AsyncWebConsole::BuiltinSink : public AsyncWebConsole::Sink {
+public:
+  enum Kind : uint8_t { Mirror, FileLog, Udp };
+  BuiltinSink(AsyncWebConsole* owner, Kind kind) : _owner(owner), _kind(kind) {}
+
+  size_t write(const char* data, size_t len) override {
+    AsyncWebConsole& o = *_owner;
+    if (_kind == FileLog) return o._appendToFile(data, len) ? len : 0;
+    if (_kind == Udp) return o._udpWrite(data, len);
+    Print* out = o._cfg.mirrorOut;
+    if (!out) return len;
+    // Streams that don't implement availableForWrite() report 0 forever:
+    // write those through as before
+    int room = out->availableForWrite();
+    if (room > 0) o._mirrorSawRoom = true;
+    size_t n = len;
+    if (o._mirrorSawRoom) n = room > 0 ? min(len, static_cast<size_t>(room)) : 0;
+    return n ? out->write(reinterpret_cast<const uint8_t*>(data), n) : 0;
+  }
+
+  bool accept(esp_log_level_t level, bool fromIdf) override {
+    const Config& cfg = _owner->_cfg;
+    if (_kind == FileLog) return cfg.fileLogEnable;
+    if (_kind == Udp) return cfg.udpHost && *cfg.udpHost && level <= cfg.udpMaxLevel;
+    // Passthrough already printed IDF lines on the UART
+    return cfg.mirrorOut && !(fromIdf && cfg.idfPassthrough);
+  }
+
+private:
+  AsyncWebConsole* _owner;
+  Kind _kind;
+};
+
 AsyncWebConsole::AsyncWebConsole(const char* wsPath, size_t backlogBytes)
 : AsyncWebConsole(wsPath, backlogBytes, Config{})
 {}
@@ -70,7 +602,26 @@ AsyncWebConsole::AsyncWebConsole(const char* wsPath, size_t backlogBytes, const
 : _ws(wsPath), _wsPath(wsPath)
 {
   _cfg = cfg;
-  if (backlogBytes) { _logbuf = (char*)malloc(backlogBytes); _bufCap = backlogBytes; }
+  // The backlog ring doubles as the per-client WebSocket staging area, so a
+  // small one is kept even when no replay backlog is requested.
+  _backlogReplay = backlogBytes > 0;
+  if (!backlogBytes) backlogBytes = max(_cfg.wsBatchMaxBytes * 2, static_cast<size_t>(2048));
+  _logbuf = static_cast<char*>(_capsMallocStrict(backlogBytes, _cfg.backlogCaps));
+  if (!_logbuf) {
+    // Requested caps unavailable (e.g. no PSRAM): don't take the full size from internal RAM
+    if (_cfg.backlogCaps && _cfg.backlogFallbackBytes && _cfg.backlogFallbackBytes < backlogBytes)
+      backlogBytes = _cfg.backlogFallbackBytes;
+    _logbuf = static_cast<char*>(malloc(backlogBytes));
+  }
+  if (_logbuf) _bufCap = backlogBytes;
+  else ESP_LOGW(TAG, "Backlog allocation failed (%u bytes)", static_cast<unsigned>(backlogBytes));
+  _ringInit(_cfg.ringBytes);
+  _crashRecover();
+#if defined(AWC_HAVE_ESP_RANDOM)
+  _epoch = esp_random();
+#else
+  _epoch = micros() ^ static_cast<uint32_t>(reinterpret_cast<uintptr_t>(this));
+#endif
   _ws.onEvent([this](AsyncWebSocket *srv,
                      AsyncWebSocketClient *cli,
                      AwsEventType type, void *arg,
@@ -79,34 +630,115 @@ AsyncWebConsole::AsyncWebConsole(const char* wsPath, size_t backlogBytes, const
   });
   _q = xQueueCreate(_cfg.queueLen, sizeof(LogMsg));
   _mtx = xSemaphoreCreateMutex();
+  _sinkMtx = xSemaphoreCreateMutex();
+  addCommand("stats", "[reset]", "Pipeline counters",
+    [this](int argc, const String* argv){
+      String out = _statsText(stats());
+      if (argc > 1 && argv[1] == F("reset")) { resetStats(); out += F("(reset)\n"); }
+      return out;
+    });
+  addCommand("grep", "<text> [--files]", "Search the backlog (and log files)",
+    [this](int argc, const String* argv){ return _grepStart(argc, argv); });
+  if (_cfg.benchCommand) {
+    addCommand("awcbench", "<rate> <seconds> <len> [tasks] [--isr]", "Generate log load and report",
+      [this](int argc, const char* const* argv, CmdWriter& out){ _benchRun(argc, argv, out); });
+  }
+  // Mirror and file logging are sinks like any other (Block policy via
+  // mirrorBlockMs / fileBlockMs, read from the config at push time)
+  if (_logbuf) {
+    _mirrorSink = new BuiltinSink(this, BuiltinSink::Mirror);
+    _fileSink = new BuiltinSink(this, BuiltinSink::FileLog);
+    _addSinkSlot(_mirrorSink, SinkPolicy::DropOldest, 0, true);
+    _addSinkSlot(_fileSink, SinkPolicy::DropOldest, 0, true);
+#if AWC_HAVE_ASYNCUDP
+    _udpSink = new BuiltinSink(this, BuiltinSink::Udp);
+    _addSinkSlot(_udpSink, SinkPolicy::DropOldest, 0, true);
+#endif
+  }
   _startDrainTask();
 }
 
 AsyncWebConsole::~AsyncWebConsole() {
-  // Unhook bridges if this instance owns them
-  if (_sink == this) {
-    if (_origVprintf) esp_log_set_vprintf(_origVprintf);
-    _sink = nullptr;
-    _origVprintf = nullptr;
+  // Unhook bridges this instance is part of
+  disableEspLogBridge();
+  if (_etsSink == this) _etsSink = nullptr;
+  // Leave the host's channel table, or release our own channels. The host
+  // only calls into a channel under its own _mtx, so once the slot is cleared
+  // here no host event is still inside this console.
+  if (_wsHost) {
+    AsyncWebConsole* host = _wsHost;
+    if (host->_mtx) xSemaphoreTake(host->_mtx, portMAX_DELAY);
+    for (size_t i = 0; i < kMaxChannels; ++i) {
+      if (host->_channels[i] == this) { host->_channels[i] = nullptr; host->_chanCount--; }
+    }
+    if (host->_mtx) xSemaphoreGive(host->_mtx);
   }
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < kMaxChannels; ++i) {
+    if (_channels[i]) _channels[i]->_wsHost = nullptr;
+    _channels[i] = nullptr;
+  }
+  _chanCount = 0;
+  if (_mtx) xSemaphoreGive(_mtx);
 
+  _cmdStopTask();
+  _grepStopTask();
   _stopDrainTask();
 
   // Drain remaining queued messages
   if (_q) {
     LogMsg msg;
     while (xQueueReceive(_q, &msg, 0) == pdTRUE) {
-      free(msg.data);
+      _freeLine(msg.data);
     }
     vQueueDelete(_q);
     _q = nullptr;
   }
+  _ringDeinit();
+
+  for (size_t i = 0; i < _sinkCount; i++) free(_sinks[i].buf);
+  _sinkCount = 0;
+  delete _mirrorSink;
+  delete _fileSink;
+  delete _udpSink;
+  _mirrorSink = _fileSink = _udpSink = nullptr;
+  delete[] _cmds;
+  _cmds = nullptr;
+  _cmdCount = _cmdCap = 0;
+  _udpFlush();
+  _udpReset();
+  if (_sinkMtx) {
+    vSemaphoreDelete(_sinkMtx);
+    _sinkMtx = nullptr;
+  }
+
+  _fileFlush(true);
+  _fileStopTask();
+  _fileClose();
+  free(_fileBuf[0]);
+  free(_fileBuf[1]);
+  _fileBuf[0] = _fileBuf[1] = nullptr;
 
   if (_mtx) {
     vSemaphoreDelete(_mtx);
     _mtx = nullptr;
   }
 
+  free(_renderBuf);
+  _renderBuf = nullptr;
+  _renderCap = 0;
+  free(_lzBuf);
+  _lzBuf = nullptr;
+  _lzCap = 0;
+  free(_lzTable);
+  _lzTable = nullptr;
+#if AWC_CRASHLOG_BYTES
+  if (_crashOwner) s_crashOwned = false;
+#endif
+  free(_prevBoot);
+  _prevBoot = nullptr;
+  _prevBootLen = 0;
+
   free(_logbuf);
   _logbuf = nullptr;
   _bufCap = 0;
@@ -115,30 +747,378 @@ AsyncWebConsole::~AsyncWebConsole() {
 
 void AsyncWebConsole::attachTo(AsyncWebServer& server, const char* routePath) {
   _server = &server;
+  // Counters and downloads next to the page. Registered first: the page
+  // handler would otherwise also match "<routePath>/stats" etc.
+  String base = routePath ? routePath : "/";
+  if (!base.endsWith("/")) base += '/';
+  _server->on((base + "stats").c_str(), HTTP_GET, [this](AsyncWebServerRequest* r){
+    r->send(200, "application/json", statsJson());
+  });
+  if (_cfg.httpDownloads) {
+    _server->on((base + "backlog").c_str(), HTTP_GET, [this](AsyncWebServerRequest* r){
+      _sendDownload(r, -1);
+    });
+    _server->on((base + "logfile").c_str(), HTTP_GET, [this](AsyncWebServerRequest* r){
+      if (!r->hasParam("n")) { r->send(200, "application/json", _logFilesJson()); return; }
+      _sendDownload(r, static_cast<int>(r->getParam("n")->value().toInt()));
+    });
+  }
+#if AWC_CRASHLOG_BYTES
+  _server->on((base + "prevboot").c_str(), HTTP_GET, [this](AsyncWebServerRequest* r){
+    if (!_prevBoot) { r->send(404, "text/plain", "no log from a previous boot\n"); return; }
+    r->send(r->beginResponse(200, "text/plain; charset=utf-8",
+                             reinterpret_cast<const uint8_t*>(_prevBoot), _prevBootLen));
+  });
+#endif
+  // Settings for the bundled page, which is cached and so can't carry them
+  _server->on((base + "config").c_str(), HTTP_GET, [this](AsyncWebServerRequest* r){
+    char json[160];
+    snprintf(json, sizeof(json), "{\"wsPath\":\"%s\",\"bin\":%d,\"lz\":%d",
+             _wsPath, _cfg.wsBinary ? 1 : 0, (_cfg.wsBinary && _cfg.wsCompress) ? 1 : 0);
+    String body(json);
+    if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+    if (_chanCount) {
+      // Indexed by channel id; removed channels are null
+      body += F(",\"channels\":[\"");
+      body += _cfg.channelName;
+      body += '"';
+      size_t last = 0;
+      for (size_t i = 0; i < kMaxChannels; ++i) if (_channels[i]) last = i + 1;
+      for (size_t i = 0; i < last; ++i) {
+        if (!_channels[i]) { body += F(",null"); continue; }
+        body += F(",\"");
+        body += _chanNames[i];
+        body += '"';
+      }
+      body += ']';
+    }
+    if (_mtx) xSemaphoreGive(_mtx);
+    body += '}';
+    AsyncWebServerResponse* resp = r->beginResponse(200, "application/json", body);
+    resp->addHeader("Cache-Control", "no-store");
+    r->send(resp);
+  });
   _server->on(routePath, HTTP_GET, [this](AsyncWebServerRequest* r){
-    AsyncResponseStream* response = r->beginResponseStream("text/html; charset=utf-8");
-    // Inject wsPath so the HTML client connects to the correct WebSocket endpoint
-    response->printf("<script>window.__AWC_WS_PATH='%s';</script>", _wsPath);
-    // Stream PROGMEM HTML in chunks to avoid copying entire page into RAM
-    const char* p = _indexHtml;
-    size_t remaining = strlen_P(_indexHtml);
-    char buf[512];
-    while (remaining > 0) {
-      size_t n = remaining < sizeof(buf) ? remaining : sizeof(buf);
-      memcpy_P(buf, p, n);
-      response->write((const uint8_t*)buf, n);
-      p += n;
-      remaining -= n;
-    }
-    r->send(response);
+    _sendPage(r);
   });
   _server->addHandler(&_ws);
 }
 
+void AsyncWebConsole::_sendPage(AsyncWebServerRequest* r) {
+  if (_indexHtml == _defaultIndexHtml) {
+    // Served straight from flash; the ETag is over the page, so a reload is a 304
+    char cache[40];
+    if (_cfg.pageMaxAgeSec) snprintf(cache, sizeof(cache), "max-age=%lu", (unsigned long)_cfg.pageMaxAgeSec);
+    else strcpy(cache, "no-cache");
+    AsyncWebServerResponse* resp;
+    if (r->hasHeader("If-None-Match") && r->header("If-None-Match") == AWC_INDEX_HTML_GZ_ETAG) {
+      resp = r->beginResponse(304, "text/html; charset=utf-8");
+    } else if (r->hasHeader("Accept-Encoding") && r->header("Accept-Encoding").indexOf("gzip") >= 0) {
+      resp = r->beginResponse_P(200, "text/html; charset=utf-8", kIndexHtmlGz, sizeof(kIndexHtmlGz));
+      resp->addHeader("Content-Encoding", "gzip");
+    } else {
+      resp = r->beginResponse_P(200, "text/html; charset=utf-8",
+                                reinterpret_cast<const uint8_t*>(_defaultIndexHtml), strlen_P(_defaultIndexHtml));
+    }
+    resp->addHeader("ETag", AWC_INDEX_HTML_GZ_ETAG);   // weak: same for both encodings
+    resp->addHeader("Cache-Control", cache);
+    resp->addHeader("Vary", "Accept-Encoding");
+    r->send(resp);
+    return;
+  }
+  AsyncResponseStream* response = r->beginResponseStream("text/html; charset=utf-8");
+  // Inject wsPath (and binary frame support) so the HTML client connects to the correct WebSocket endpoint
+  response->printf("<script>window.__AWC_WS_PATH='%s';window.__AWC_WS_BIN=%d;window.__AWC_WS_LZ=%d;</script>",
+                   _wsPath, _cfg.wsBinary ? 1 : 0, (_cfg.wsBinary && _cfg.wsCompress) ? 1 : 0);
+  // Stream PROGMEM HTML in chunks to avoid copying entire page into RAM
+  const char* p = _indexHtml;
+  size_t remaining = strlen_P(_indexHtml);
+  char buf[512];
+  while (remaining > 0) {
+    size_t n = remaining < sizeof(buf) ? remaining : sizeof(buf);
+    memcpy_P(buf, p, n);
+    response->write((const uint8_t*)buf, n);
+    p += n;
+    remaining -= n;
+  }
+  r->send(response);
+}
+
+// HTTP downloads. Each response owns a Download that reads the next piece
+// from the backlog ring (rendered like text frames) or the open File when
+// the server asks for more, so nothing is built in RAM.
+//
+// gzip: every piece is one fixed-Huffman deflate block, greedy LZ77 over a
+// 3-byte hash within the piece. About 3x on logs, for ~3 KB per response
+// (hash table and one compressed block) and no window kept between pieces.
+static constexpr size_t kDlChunk = 1024;
+static constexpr int    kGzHashBits = 10;
+
+struct AsyncWebConsole::GzipStream {
+  uint32_t crc = 0xFFFFFFFF;
+  uint32_t size = 0;
+  uint32_t bits = 0;  // pending output bits, LSB first
+  uint8_t  nbits = 0;
+  bool     started = false;
+  bool     done = false;
+  uint16_t head[1 << kGzHashBits];
+  uint8_t  out[16 + kDlChunk + kDlChunk / 8 + 16]; // header + one block, or the trailer
+  size_t   outLen = 0, outPos = 0; // served to the server as much as fits per call
+};
+
+struct AsyncWebConsole::Download {
+  AsyncWebConsole* self = nullptr;
+  uint32_t pos = 0, end = 0; // backlog range still to send
+  bool     lineStart = true;
+  bool     fromFile = false;
+  File     file;
+  GzipStream* gz = nullptr;
+  char     in[kDlChunk];
+  ~Download() { if (file) file.close(); delete gz; }
+};
+
+static uint32_t _crc32(uint32_t crc, const uint8_t* p, size_t n) {
+  static const uint32_t t[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C };
+  while (n--) {
+    crc ^= *p++;
+    crc = (crc >> 4) ^ t[crc & 15];
+    crc = (crc >> 4) ^ t[crc & 15];
+  }
+  return crc;
+}
+
+struct _BitOut {
+  uint32_t& bits; uint8_t& nbits; uint8_t* out; size_t n;
+  void put(uint32_t v, int len) {
+    bits |= v << nbits;
+    nbits += len;
+    while (nbits >= 8) { out[n++] = static_cast<uint8_t>(bits); bits >>= 8; nbits -= 8; }
+  }
+  void code(uint32_t c, int len) { // Huffman codes go out MSB first
+    uint32_t r = 0;
+    for (int i = 0; i < len; i++) { r = (r << 1) | (c & 1); c >>= 1; }
+    put(r, len);
+  }
+  void sym(unsigned s) {
+    if (s < 144)      code(0x30 + s, 8);
+    else if (s < 256) code(0x190 + s - 144, 9);
+    else if (s < 280) code(s - 256, 7);
+    else              code(0xC0 + s - 280, 8);
+  }
+};
+
+static const uint16_t kLenBase[29] = { 3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258 };
+static const uint8_t  kLenExtra[29] = { 0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0 };
+static const uint16_t kDistBase[30] = { 1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577 };
+static const uint8_t  kDistExtra[30] = { 0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13 };
+
+// One non-final fixed-Huffman block for in[0, n); returns whole bytes written.
+// At most (9 * n + 17) / 8 + 1 bytes.
+static size_t _deflateBlock(uint16_t* head, uint32_t& bits, uint8_t& nbits,
+                            const uint8_t* in, size_t n, uint8_t* out) {
+  _BitOut bo{bits, nbits, out, 0};
+  bo.put(0, 1); // BFINAL = 0
+  bo.put(1, 2); // BTYPE = fixed Huffman
+  memset(head, 0xFF, sizeof(uint16_t) << kGzHashBits);
+  auto hash = [&](size_t i) { return ((in[i] << 6) ^ (in[i + 1] << 3) ^ in[i + 2]) & ((1u << kGzHashBits) - 1); };
+  for (size_t i = 0; i < n; ) {
+    size_t best = 0, dist = 0;
+    if (i + 3 <= n) {
+      uint32_t h = hash(i);
+      uint16_t cand = head[h];
+      head[h] = static_cast<uint16_t>(i);
+      if (cand != 0xFFFF) {
+        size_t max = min(static_cast<size_t>(258), n - i), m = 0;
+        while (m < max && in[cand + m] == in[i + m]) m++;
+        if (m >= 3) { best = m; dist = i - cand; }
+      }
+    }
+    if (!best) { bo.sym(in[i++]); continue; }
+    int lc = 28;
+    while (kLenBase[lc] > best) lc--;
+    bo.sym(257 + lc);
+    if (kLenExtra[lc]) bo.put(static_cast<uint32_t>(best - kLenBase[lc]), kLenExtra[lc]);
+    int dc = 29;
+    while (kDistBase[dc] > dist) dc--;
+    bo.code(dc, 5);
+    if (kDistExtra[dc]) bo.put(static_cast<uint32_t>(dist - kDistBase[dc]), kDistExtra[dc]);
+    for (size_t k = 1; k < best && i + k + 3 <= n; k++) head[hash(i + k)] = static_cast<uint16_t>(i + k);
+    i += best;
+  }
+  bo.sym(256);
+  return bo.n;
+}
+
+void AsyncWebConsole::_sendDownload(AsyncWebServerRequest* r, int fileIndex){
+  auto dl = std::make_shared<Download>();
+  dl->self = this;
+  String name = F("backlog.txt");
+  if (fileIndex < 0) {
+    if (!_logbuf) { r->send(404, "text/plain", "no backlog\n"); return; }
+    // Snapshot bounds: oldest full line up to the current end
+    if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+    dl->pos = _wpos - static_cast<uint32_t>(_used);
+    if (_used == _bufCap) {
+      uint32_t nl = _backlogFindNl(dl->pos, _wpos);
+      if (nl != _wpos) dl->pos = nl + 1;
+    }
+    dl->end = _wpos;
+    if (_mtx) xSemaphoreGive(_mtx);
+  } else {
+#if defined(AWC_HAS_LITTLEFS) || defined(AWC_HAS_SPIFFS)
+    String path = _cfg.filePath ? String(_cfg.filePath) : String();
+    if (fileIndex) path += "." + String(fileIndex);
+#if defined(AWC_HAS_LITTLEFS)
+    if (_cfg.filePath && fileIndex <= _cfg.maxFiles && LittleFS.exists(path)) dl->file = LittleFS.open(path, FILE_READ);
+#else
+    if (_cfg.filePath && fileIndex <= _cfg.maxFiles && SPIFFS.exists(path)) dl->file = SPIFFS.open(path, FILE_READ);
+#endif
+    if (!dl->file) { r->send(404, "text/plain", "no such log file\n"); return; }
+    dl->fromFile = true;
+    int slash = path.lastIndexOf('/');
+    name = slash >= 0 ? path.substring(slash + 1) : path;
+#else
+    r->send(404, "text/plain", "no filesystem\n");
+    return;
+#endif
+  }
+
+  // gzip when the client accepts it; ?gzip=0/1 overrides
+  bool gzip = r->hasHeader("Accept-Encoding") && r->header("Accept-Encoding").indexOf("gzip") >= 0;
+  if (r->hasParam("gzip")) gzip = r->getParam("gzip")->value() != "0";
+  if (gzip) dl->gz = new GzipStream();
+
+  AsyncWebServerResponse* resp = r->beginChunkedResponse("text/plain; charset=utf-8",
+    [dl](uint8_t* buf, size_t maxLen, size_t){ return dl->self->_downloadFill(*dl, buf, maxLen); });
+  if (gzip) resp->addHeader("Content-Encoding", "gzip");
+  resp->addHeader("Content-Disposition", String(F("attachment; filename=\"")) + name + '"');
+  r->send(resp);
+}
+
+// Next piece of plain text: file bytes, or rendered backlog lines
+size_t AsyncWebConsole::_downloadRead(Download& dl, char* out, size_t cap){
+  if (dl.fromFile) {
+    int r = dl.file.read(reinterpret_cast<uint8_t*>(out), cap);
+    return r > 0 ? static_cast<size_t>(r) : 0;
+  }
+  size_t n = 0;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  if (static_cast<int32_t>(oldest - dl.pos) > 0 && static_cast<int32_t>(dl.end - dl.pos) > 0) {
+    // Overwritten while the download was slow: say so, go on at the next full line
+    uint32_t skip = oldest - dl.pos;
+    dl.pos = oldest;
+    uint32_t nl = _backlogFindNl(oldest, _wpos);
+    if (nl != _wpos) { skip += nl + 1 - dl.pos; dl.pos = nl + 1; }
+    int w = snprintf(out, cap, "%s[AsyncWebConsole] skipped %u bytes\n", dl.lineStart ? "" : "\n",
+                     static_cast<unsigned>(skip));
+    n = w > 0 ? min(static_cast<size_t>(w), cap - 1) : 0;
+    dl.lineStart = true;
+  }
+  if (static_cast<int32_t>(dl.end - dl.pos) > 0 && n < cap) {
+    // Rendering at most doubles a line (8-byte header -> 15-byte timestamp)
+    size_t room = cap - n;
+    size_t left = dl.end - dl.pos;
+    // A record header is rendered whole or not at all
+    size_t minLen = (dl.lineStart && _backlogAt(dl.pos) == kRecMark) ? min(kRecHdrLen + 1, left) : 1;
+    size_t len = max(_wsChunkLen(dl.pos, min(max(room / 2, static_cast<size_t>(1)), left)), minLen);
+    while (len > minLen && _backlogRender(dl.pos, len, dl.lineStart, nullptr) > room)
+      len = max(_wsChunkLen(dl.pos, len / 2), minLen);
+    if (_backlogRender(dl.pos, len, dl.lineStart, nullptr) <= room) {
+      n += _backlogRender(dl.pos, len, dl.lineStart, out + n);
+      dl.lineStart = _backlogAt(dl.pos + len - 1) == '\n';
+      dl.pos += static_cast<uint32_t>(len);
+    } // else: no room for the timestamp, it goes in the next chunk
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  return n;
+}
+
+// Chunked response filler; 0 ends the response
+size_t AsyncWebConsole::_downloadFill(Download& dl, uint8_t* out, size_t maxLen){
+  GzipStream* z = dl.gz;
+  if (!z) {
+    size_t n = _downloadRead(dl, reinterpret_cast<char*>(out), maxLen);
+#ifdef RESPONSE_TRY_AGAIN
+    // Too little room for the next timestamp: 0 would end the response
+    if (!n && !dl.fromFile && static_cast<int32_t>(dl.end - dl.pos) > 0) return RESPONSE_TRY_AGAIN;
+#endif
+    return n;
+  }
+  if (z->outPos == z->outLen) {
+    if (z->done) return 0;
+    size_t n = 0;
+    if (!z->started) {
+      static const uint8_t hdr[10] = { 0x1f, 0x8b, 8, 0, 0, 0, 0, 0, 0, 0xFF };
+      memcpy(z->out, hdr, sizeof(hdr));
+      n = sizeof(hdr);
+      z->started = true;
+    }
+    size_t raw = _downloadRead(dl, dl.in, kDlChunk);
+    if (raw) {
+      z->crc = _crc32(z->crc, reinterpret_cast<const uint8_t*>(dl.in), raw);
+      z->size += static_cast<uint32_t>(raw);
+      n += _deflateBlock(z->head, z->bits, z->nbits, reinterpret_cast<const uint8_t*>(dl.in), raw, z->out + n);
+    } else {
+      // End: empty final block, pad to a byte, CRC-32 and length
+      _BitOut bo{z->bits, z->nbits, z->out + n, 0};
+      bo.put(1, 1);
+      bo.put(1, 2);
+      bo.sym(256);
+      if (z->nbits) bo.put(0, 8 - z->nbits);
+      n += bo.n;
+      uint32_t crc = ~z->crc;
+      for (int i = 0; i < 4; i++) z->out[n++] = static_cast<uint8_t>(crc >> (8 * i));
+      for (int i = 0; i < 4; i++) z->out[n++] = static_cast<uint8_t>(z->size >> (8 * i));
+      z->done = true;
+    }
+    z->outLen = n;
+    z->outPos = 0;
+  }
+  size_t k = min(maxLen, z->outLen - z->outPos);
+  memcpy(out, z->out + z->outPos, k);
+  z->outPos += k;
+  return k;
+}
+
+String AsyncWebConsole::_logFilesJson() const {
+  String s = "[";
+#if defined(AWC_HAS_LITTLEFS) || defined(AWC_HAS_SPIFFS)
+  for (int i = 0; _cfg.filePath && i <= _cfg.maxFiles; i++) {
+    String path = String(_cfg.filePath);
+    if (i) path += "." + String(i);
+#if defined(AWC_HAS_LITTLEFS)
+    if (!LittleFS.exists(path)) continue;
+    File f = LittleFS.open(path, FILE_READ);
+#else
+    if (!SPIFFS.exists(path)) continue;
+    File f = SPIFFS.open(path, FILE_READ);
+#endif
+    if (!f) continue;
+    char item[32];
+    snprintf(item, sizeof(item), "%s{\"n\":%d,\"size\":%u,", s.length() > 1 ? "," : "", i, static_cast<unsigned>(f.size()));
+    f.close();
+    s += item;
+    s += F("\"path\":\"");
+    s += path;
+    s += F("\"}");
+  }
+#endif
+  s += ']';
+  return s;
+}
+
 void AsyncWebConsole::pushLineToBuffer(const char * s){
-  if (!_logbuf || _bufCap == 0) return;
-  size_t sl = strlen(s);
+  if (s) _pushBytes(s, strlen(s));
+}
+
+void AsyncWebConsole::_pushBytes(const char* s, size_t sl){
+  if (!_logbuf || _bufCap == 0 || !sl) return;
+  _wpos += static_cast<uint32_t>(sl);
   if (sl >= _bufCap){
+    _stats.backlogEvicted.fetch_add(_used + (sl - _bufCap), std::memory_order_relaxed);
     // keep tail of the line only
     const char* src = s + (sl - _bufCap);
     memcpy(_logbuf, src, _bufCap);
@@ -148,6 +1128,7 @@ void AsyncWebConsole::pushLineToBuffer(const char * s){
   if (_used + sl > _bufCap){
     size_t need = (_used + sl) - _bufCap;
     if (need > _used) need = _used;
+    _stats.backlogEvicted.fetch_add(need, std::memory_order_relaxed);
     _head = (_head + need) % _bufCap;
     _used -= need;
   }
@@ -163,249 +1144,1009 @@ void AsyncWebConsole::print(const String& s) { printf("%s", s.c_str()); }
 
 void AsyncWebConsole::printf(const char* fmt, ...){
   va_list ap2; va_start(ap2, fmt);
-  char *s = _vsformat(fmt, _cfg.maxLineLen, ap2);
+  char *s = _formatLine(fmt, ap2);
   va_end(ap2);
   if (s) _enqueueRaw(s);
 }
 
+// Producer ring
+void AsyncWebConsole::_ringInit(size_t bytes){
+  _ringDeinit();
+  bytes &= ~static_cast<size_t>(3); // records are 4-byte aligned
+  if (bytes < 64) return;
+  _ring = static_cast<char*>(_capsMalloc(bytes, _cfg.bufferCaps));
+  if (!_ring) {
+    ESP_LOGW(TAG, "Producer ring allocation failed (%u bytes), using malloc per line", static_cast<unsigned>(bytes));
+    return;
+  }
+  _ringCap = bytes;
+  _ringRd = _ringWr = _ringFill = 0;
+}
+
+void AsyncWebConsole::_ringDeinit(){
+  free(_ring);
+  _ring = nullptr;
+  _ringCap = 0;
+  _ringRd = _ringWr = _ringFill = 0;
+}
+
+char* IRAM_ATTR AsyncWebConsole::_ringReserve(size_t payload){
+  size_t need = (sizeof(RingRec) + payload + 3) & ~static_cast<size_t>(3);
+  if (!_ring) return nullptr;
+  if (need > 0xFFFF || need > _ringCap) { _stats.droppedNoMem.fetch_add(1, std::memory_order_relaxed); return nullptr; }
+
+  char* p = nullptr;
+  portENTER_CRITICAL_SAFE(&_ringMux);
+  // Records never wrap: if the tail is too short, pad it out and start over at 0
+  size_t contiguous = _ringCap - _ringWr;
+  size_t total = (contiguous < need) ? contiguous + need : need;
+  if (_ringFill + total <= _ringCap) {
+    if (contiguous < need) {
+      RingRec* pad = reinterpret_cast<RingRec*>(_ring + _ringWr);
+      pad->size  = static_cast<uint16_t>(contiguous);
+      pad->state = RING_FREE;
+      _ringWr = 0;
+    }
+    RingRec* rec = reinterpret_cast<RingRec*>(_ring + _ringWr);
+    rec->size  = static_cast<uint16_t>(need);
+    rec->state = RING_BUSY;
+    p = _ring + _ringWr + sizeof(RingRec);
+    _ringWr += need;
+    if (_ringWr == _ringCap) _ringWr = 0;
+    _ringFill += total;
+  }
+  portEXIT_CRITICAL_SAFE(&_ringMux);
+  if (!p) _stats.droppedNoMem.fetch_add(1, std::memory_order_relaxed);
+  return p;
+}
+
+void AsyncWebConsole::_ringShrink(char* p, size_t payload){
+  // Give back the unused part of the reservation if nobody reserved after us
+  size_t need = (sizeof(RingRec) + payload + 3) & ~static_cast<size_t>(3);
+  size_t off = static_cast<size_t>(p - _ring) - sizeof(RingRec);
+  RingRec* rec = reinterpret_cast<RingRec*>(_ring + off);
+
+  portENTER_CRITICAL_SAFE(&_ringMux);
+  size_t end = off + rec->size;
+  if (end == _ringCap) end = 0;
+  if (need < rec->size && _ringWr == end) {
+    _ringFill -= rec->size - need;
+    rec->size = static_cast<uint16_t>(need);
+    _ringWr = off + need;
+  }
+  portEXIT_CRITICAL_SAFE(&_ringMux);
+}
+
+void IRAM_ATTR AsyncWebConsole::_ringRelease(char* p){
+  RingRec* rec = reinterpret_cast<RingRec*>(p - sizeof(RingRec));
+
+  portENTER_CRITICAL_SAFE(&_ringMux);
+  rec->state = RING_FREE;
+  // Records may be released out of order; reclaim the released prefix
+  while (_ringFill) {
+    RingRec* oldest = reinterpret_cast<RingRec*>(_ring + _ringRd);
+    if (oldest->state != RING_FREE) break;
+    _ringFill -= oldest->size;
+    _ringRd += oldest->size;
+    if (_ringRd == _ringCap) _ringRd = 0;
+  }
+  if (!_ringFill) _ringRd = _ringWr;
+  portEXIT_CRITICAL_SAFE(&_ringMux);
+}
+
+char* AsyncWebConsole::_allocLine(size_t n){
+  if (_ring) return _ringReserve(n);
+  char* p = (char*)malloc(n);
+  if (!p) _stats.droppedNoMem.fetch_add(1, std::memory_order_relaxed);
+  return p;
+}
+
+void IRAM_ATTR AsyncWebConsole::_freeLine(char* p){
+  if (!p) return;
+  if (_ringOwns(p)) _ringRelease(p);
+  else free(p);
+}
+
+char* AsyncWebConsole::_formatLine(const char* fmt, va_list ap){
+  if (!_ring) return _vsformat(fmt, _cfg.maxLineLen, ap);
+
+  size_t maxLen = _cfg.maxLineLen ? _cfg.maxLineLen : _ringCap / 4;
+  if (maxLen > 0xFFFF - sizeof(RingRec) - 8) maxLen = 0xFFFF - sizeof(RingRec) - 8;
+
+  // Measure first so the reservation is the line's size, not maxLineLen:
+  // shrinking only works while nobody reserved after us, which concurrent
+  // producers rarely allow. Short lines are copied from the scratch buffer,
+  // longer ones are formatted again in place.
+  char tmp[128];
+  va_list ap2; va_copy(ap2, ap);
+  int n = vsnprintf(tmp, sizeof(tmp), fmt, ap2);
+  va_end(ap2);
+  if (n <= 0) return nullptr;
+  size_t len = min(static_cast<size_t>(n), maxLen);
+  char* p = _ringReserve(len + 2);
+  if (!p) return nullptr;
+
+  if (static_cast<size_t>(n) < sizeof(tmp)) memcpy(p, tmp, len);
+  else vsnprintf(p, len + 1, fmt, ap);
+  if (p[len - 1] != '\n') p[len++] = '\n';
+  p[len] = '\0';
+  _ringShrink(p, len + 1);
+  return p;
+}
+
+char* AsyncWebConsole::_captureDeferred(const char* fmt, va_list ap){
+#if defined(AWC_HAVE_PTR_IN_DROM)
+  // Only flash-resident formats outlive the caller (ESP_LOGx literals are)
+  if (!esp_ptr_in_drom(fmt)) return nullptr;
+#else
+  return nullptr;
+#endif
+  size_t strMax = _cfg.maxLineLen ? _cfg.maxLineLen : 256;
+
+  va_list ap2; va_copy(ap2, ap);
+  size_t argLen = _deferPack(fmt, ap2, nullptr, strMax);
+  va_end(ap2);
+  bool hasSpec = strchr(fmt, '%') != nullptr;
+  if ((!argLen && hasSpec) || argLen > 0xFFFF) return nullptr;
+
+  uint16_t len16 = static_cast<uint16_t>(argLen);
+  char* rec = _allocLine(sizeof(fmt) + sizeof(len16) + argLen);
+  if (!rec) return nullptr;
+  memcpy(rec, &fmt, sizeof(fmt));
+  memcpy(rec + sizeof(fmt), &len16, sizeof(len16));
+  if (argLen) {
+    va_copy(ap2, ap);
+    _deferPack(fmt, ap2, rec + sizeof(fmt) + sizeof(len16), strMax);
+    va_end(ap2);
+  }
+  return rec;
+}
+
 void AsyncWebConsole::sendBacklog(AsyncWebSocketClient* c){
   if (!c) return;
-  char* blob = nullptr;
-  size_t blobLen = 0;
 
+  // Only the cursor is rewound here; the drain task streams the backlog from
+  // the ring in bounded frames as this client's send queue drains.
   if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
-  if (_logbuf && _used) {
-    blob = (char*)malloc(_used + 1);
-    if (blob) {
-      size_t first = _bufCap - _head;
-      if (first > _used) first = _used;
-      memcpy(blob, _logbuf + _head, first);
-      if (first < _used) {
-        memcpy(blob + first, _logbuf, _used - first);
+  int slot = _wsAttachClient(c->id());
+  if (slot >= 0) {
+    WsClientSlot& cs = _wsClients[slot];
+    uint32_t start = _wpos;
+    if (_backlogReplay && _logbuf && _used) {
+      start = _wpos - static_cast<uint32_t>(_used);
+      if (_used == _bufCap) {
+        // Ring has wrapped: the oldest line is partial, begin at the next one
+        uint32_t nl = _backlogFindNl(start, _wpos);
+        if (nl != _wpos) start = nl + 1;
       }
-      blobLen = _used;
-      blob[blobLen] = '\0';
     }
+    cs.pos = start;
+    cs.replayEnd = _wpos;
+    cs.skipped = 0;
+    cs.midLine = false;
+    cs.gen++;
   }
   if (_mtx) xSemaphoreGive(_mtx);
-
-  if (blob) {
-    if (blobLen) c->text(blob);
-    free(blob);
-  }
+  _wakeDrain();
 }
 
 // Queue helpers
-bool AsyncWebConsole::_enqueueRaw(char* data, bool fromIdf){
+bool IRAM_ATTR AsyncWebConsole::_enqueueRaw(char* data, bool fromIdf, bool deferred, uint8_t level){
   if (!data || !_q) return false;
 
   bool result = true;
 
-  LogMsg msg{ data, fromIdf };
+  LogMsg msg{ data, fromIdf, deferred, level, static_cast<uint8_t>(xPortGetCoreID()), micros() };
   if (_inIsr()) {
     BaseType_t hpw = pdFALSE;
     if (xQueueSendFromISR(_q, &msg, &hpw) != pdTRUE) { 
-      free(data); 
+      _freeLine(data); 
       result = false; 
     }
     if (hpw == pdTRUE) portYIELD_FROM_ISR();
   } else {
     if (xQueueSend(_q, &msg, 0) != pdTRUE) {
-      free(data);
+      _freeLine(data);
       result = false;
     }
   }
+  (result ? _stats.enqueued : _stats.droppedQueue).fetch_add(1, std::memory_order_relaxed);
   return result;
 }
 
+// Publishes first plus whatever else is already queued (up to drainBatch) as
+// one unit: the backlog lock is taken once and clients/sinks are pumped once,
+// so a burst goes out as a few large frames instead of one frame per line.
+void AsyncWebConsole::_handleBatch(LogMsg& first){
+  LogMsg batch[_maxDrainBatch];
+  size_t limit = _cfg.drainBatch ? min(_cfg.drainBatch, _maxDrainBatch) : 1;
+  size_t n = 0;
+  batch[n++] = first;
+  size_t room = _msgRoom(first);
+  LogMsg msg;
+  while (n < limit && !_shutdownRequested && xQueueReceive(_q, &msg, 0) == pdTRUE) {
+    if (!msg.data) continue; // wakeups: the pump below covers them
+    batch[n++] = msg;
+    room += _msgRoom(msg);
+  }
+  // Block-policy sinks wait here, not under _mtx: AsyncTCP callbacks take it
+  _sinksMakeRoom(min(room, _bufCap));
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < n; i++) _handleMsg(batch[i]);
+  if (_mtx) xSemaphoreGive(_mtx);
+
+  _outputsBehind = _pumpOutputs();
+  uint32_t now = micros();
+  for (size_t i = 0; i < n; i++) _statLatency(now - batch[i].t);
+}
+
+size_t AsyncWebConsole::_msgRoom(const LogMsg& msg) const {
+  size_t len = msg.deferred ? (_cfg.maxLineLen ? _cfg.maxLineLen : 256) + 2 : strlen(msg.data) + 1;
+  // A repeat note may go out ahead of the line
+  return kRecHdrLen + len + (_cfg.coalesceRepeats ? kRecHdrLen + 64 : 0);
+}
 
-void AsyncWebConsole::_processLine(char* data, bool fromIdf){
+void AsyncWebConsole::_handleMsg(LogMsg& msg){
+  if (msg.deferred) {
+    size_t want = (_cfg.maxLineLen ? _cfg.maxLineLen : 256) + 2;
+    if (_renderCap != want) {
+      // Contents are scratch, so free + alloc rather than realloc (keeps the caps)
+      free(_renderBuf);
+      _renderBuf = static_cast<char*>(_capsMalloc(want, _cfg.bufferCaps));
+      _renderCap = _renderBuf ? want : 0;
+    }
+    if (_renderBuf) {
+      size_t len = _deferRender(msg.data, _renderBuf, _renderCap - 1);
+      if (len && _renderBuf[len - 1] != '\n') { _renderBuf[len++] = '\n'; _renderBuf[len] = '\0'; }
+      // The tag is only known once rendered
+      esp_log_level_t lvl = msg.level != kLevelUnknown ? static_cast<esp_log_level_t>(msg.level)
+                                                       : _detectEspLogLevel(_renderBuf);
+      if (len && _allowLevel(_renderBuf, lvl)) _processLine(_renderBuf, msg);
+      else if (len) _stats.filtered.fetch_add(1, std::memory_order_relaxed);
+    }
+    _freeLine(msg.data);
+    return;
+  }
+
+  size_t len = strlen(msg.data);
+  // Ring records are newline-terminated by the producer and must not be realloc'd
+  if (len && msg.data[len - 1] != '\n' && !_ringOwns(msg.data)) {
+    char* extended = static_cast<char*>(realloc(msg.data, len + 2));
+    if (extended) {
+      extended[len] = '\n';
+      extended[len + 1] = '\0';
+      msg.data = extended;
+    }
+  }
+  _processLine(msg.data, msg);
+  _freeLine(msg.data);
+}
+
+void AsyncWebConsole::_processLine(char* data, const LogMsg& meta){
   if (!data) return;
   size_t dataLength = strlen(data);
+  if (_cfg.coalesceRepeats && !_repBypass) {
+    uint32_t h = _repeatHash(data, dataLength);
+    if (_repSeen && h == _repHash) {
+      if (!_repCount++) _repFirstMs = millis();
+      _stats.repeated.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+    _repeatFlush();
+    _repHash = h;
+    _repSeen = true;
+    _repLevel = meta.level;
+    _repFromIdf = meta.fromIdf;
+  }
+  // Stamped with the enqueue time, not when the drain task got to it
+  uint32_t ms = millis() - (micros() - meta.t) / 1000U;
+  bool fromIdf = meta.fromIdf;
+  uint8_t level = meta.level != kLevelUnknown ? meta.level : static_cast<uint8_t>(_detectEspLogLevel(data));
+  _stats.lines.fetch_add(1, std::memory_order_relaxed);
+  _stats.bytes.fetch_add(dataLength, std::memory_order_relaxed);
+
+  // Published once into the backlog ring; WebSocket clients and sinks render
+  // it from there at their own pace
+  if (_logbuf) {
+    char hdr[kRecHdrLen];
+    _recHeader(hdr, ms, level, fromIdf, meta.core);
+    _pushBytes(hdr, kRecHdrLen);
+    _pushBytes(data, dataLength);
+    if (_crashOwner) _crashAppend(hdr, data, dataLength);
+    return;
+  }
+  if (_crashOwner) {
+    char hdr[kRecHdrLen];
+    _recHeader(hdr, ms, level, fromIdf, meta.core);
+    _crashAppend(hdr, data, dataLength);
+  }
 
+  // No ring (allocation failed): write everything through synchronously
+  const char* payload = data;
+  size_t payloadLen = dataLength;
   String line;
   if (_cfg.timestamps) {
-    line = _formatTimestamp();
-    line.reserve(line.length() + dataLength + 1);
+    char ts[20];
+    size_t tl = _fmtTimestamp(ms, ts, sizeof(ts));
+    line.reserve(tl + dataLength + 1);
+    line = ts;
     line += data;
-  } else {
-    line = data;
-  }
-
-  const char* payload = nullptr;
-  size_t payloadLen = 0;
-  if (line.length()) {
     payload = line.c_str();
     payloadLen = line.length();
-  } else {
-    payload = data;
-    payloadLen = dataLength;
   }
-
-  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
-  pushLineToBuffer(payload);
-  if (_mtx) xSemaphoreGive(_mtx);
-
-  _queueWsBroadcast(payload, payloadLen);
+  _wsTextAll(payload, payloadLen);
   if (_cfg.mirrorOut && !(fromIdf && _cfg.idfPassthrough)) {
     _cfg.mirrorOut->print(payload);
   }
   if (_cfg.fileLogEnable) _appendToFile(payload, payloadLen);
 }
 
-void AsyncWebConsole::_trimWsBatch(size_t dropBytes){
-  if (!_wsBatch.length() || dropBytes == 0) return;
-  if (dropBytes >= _wsBatch.length()) {
-    _wsBatch = "";
-    return;
-  }
+// Folded repeats go out as one note under the level of the repeated line,
+// so the filters treat it the same (e.g. no mirror copy of passthrough lines)
+void AsyncWebConsole::_repeatFlush(){
+  if (!_repCount) return;
+  char note[64];
+  snprintf(note, sizeof(note), "[AsyncWebConsole] last message repeated %u times\n", static_cast<unsigned>(_repCount));
+  _repCount = 0;
+  LogMsg meta{nullptr, _repFromIdf, false, _repLevel, 0, micros()};
+  _repBypass = true;
+  _processLine(note, meta);
+  _repBypass = false;
+}
 
-  size_t removeUpTo = 0;
-  size_t remaining = dropBytes;
-  while (remaining && removeUpTo < _wsBatch.length()){
-    int newlinePos = _wsBatch.indexOf('\n', removeUpTo);
-    if (newlinePos < 0) {
-      _wsBatch = "";
-      return;
+// Drain task, once per loop: a storm that keeps going still shows up every
+// repeatFlushMs
+void AsyncWebConsole::_repeatTick(){
+  if (!_repCount || millis() - _repFirstMs < _cfg.repeatFlushMs) return;
+  _sinksMakeRoom(kRecHdrLen + 64);
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  _repeatFlush();
+  if (_mtx) xSemaphoreGive(_mtx);
+  _outputsBehind = _pumpOutputs();
+}
+
+// Crash log. The first instance takes the ring: renders what the previous
+// boot left there (oldest whole record on, control bytes shown as '?'), then
+// starts it over. Appends come from the drain task only.
+void AsyncWebConsole::_crashRecover(){
+#if AWC_CRASHLOG_BYTES
+  if (s_crashOwned) return;
+  s_crashOwned = _crashOwner = true;
+  AwcCrashLog& c = s_crashLog;
+  uint32_t end = c.wpos;
+  if (c.magic == kCrashMagic && c.size == AWC_CRASHLOG_BYTES && end && end - ~c.wposInv <= c.size) {
+    uint32_t pos = end > c.size ? end - c.size : 0;
+    char head[64];
+    int hn = snprintf(head, sizeof(head), "== previous boot (%s) ==\n", _resetReasonName());
+    // Rendering never grows a record (a timestamp replaces header and tag)
+    size_t cap = static_cast<size_t>(hn) + (end - pos) * 2 + 2;
+    char* out = static_cast<char*>(malloc(cap));
+    if (out) {
+      size_t n = static_cast<size_t>(hn);
+      memcpy(out, head, n);
+      size_t start = n;
+      char hdr[kRecHdrLen];
+      while (end - pos >= kRecHdrLen + kCrashTagLen) {
+        // Only whole records whose CRC matches are shown
+        uint32_t len = 0, sum = 0;
+        bool ok = c.data[pos % c.size] == kRecMark;
+        for (size_t i = 0; ok && i < kCrashTagLen; i++) {
+          uint8_t v = static_cast<uint8_t>(c.data[(pos + kRecHdrLen + i) % c.size] - '0');
+          ok = v < 64;
+          if (i < 3) len = (len << 6) | v;
+          else       sum = (sum << 6) | v;
+        }
+        uint32_t body = pos + kRecHdrLen + kCrashTagLen;
+        ok = ok && len <= end - body &&
+             (~_crashCrcAt(_crashCrcAt(~0u, pos, kRecHdrLen), body, len) & 0xFFFFFF) == sum;
+        if (!ok) {
+          // Torn oldest record or damage: resync on a mark that follows a newline
+          do pos++; while (pos < end && !(c.data[(pos - 1) % c.size] == '\n' && c.data[pos % c.size] == kRecMark));
+          continue;
+        }
+        for (size_t i = 0; i < kRecHdrLen; i++) hdr[i] = c.data[(pos + i) % c.size];
+        uint32_t ms; uint8_t level;
+        _recParse(hdr, ms, level);
+        if (_cfg.timestamps) n += _fmtTimestamp(ms, out + n, cap - n);
+        for (pos = body; pos < body + len; pos++) {
+          char ch = c.data[pos % c.size];
+          out[n++] = (static_cast<uint8_t>(ch) < 0x20 && ch != '\n' && ch != '\t' && ch != '\r') ? '?' : ch;
+        }
+      }
+      if (n > start) {
+        if (out[n - 1] != '\n') out[n++] = '\n';
+        out[n] = '\0';
+        char* fit = static_cast<char*>(realloc(out, n + 1));
+        _prevBoot = fit ? fit : out;
+        _prevBootLen = n;
+      } else {
+        free(out);
+      }
     }
-    size_t segment = static_cast<size_t>(newlinePos + 1 - removeUpTo);
-    removeUpTo = newlinePos + 1;
-    if (segment >= remaining) break;
-    remaining -= segment;
   }
+  c.magic = kCrashMagic;
+  c.size = AWC_CRASHLOG_BYTES;
+  c.wpos = 0;
+  c.wposInv = ~0u;
+#endif
+}
 
-  ESP_LOGW(TAG, "WS batch overflow, dropping %u bytes", static_cast<unsigned>(removeUpTo));
-
-  _wsDropMessage.reserve(96);
-  _wsDropMessage = F("[AsyncWebConsole] WS batch overflow, dropped ");
-  _wsDropMessage += static_cast<unsigned>(removeUpTo);
-  _wsDropMessage += F(" bytes\n");
-  _wsDropPending = true;
-
-  if (removeUpTo >= _wsBatch.length()) _wsBatch = "";
-  else _wsBatch.remove(0, removeUpTo);
+void AsyncWebConsole::_crashAppend(const char* hdr, const char* s, size_t n){
+#if AWC_CRASHLOG_BYTES
+  if (kRecHdrLen + kCrashTagLen + n > AWC_CRASHLOG_BYTES || n > 0x3FFFF) return; // would only be torn
+  uint32_t sum = ~_crashCrc(_crashCrc(~0u, hdr, kRecHdrLen), s, n) & 0xFFFFFF;
+  char tag[kCrashTagLen];
+  for (size_t i = 0; i < 3; i++) tag[i] = static_cast<char>('0' + ((n >> (6 * (2 - i))) & 0x3F));
+  for (size_t i = 0; i < 4; i++) tag[3 + i] = static_cast<char>('0' + ((sum >> (6 * (3 - i))) & 0x3F));
+  uint32_t w = s_crashLog.wpos;
+  _crashWrite(w, hdr, kRecHdrLen);
+  _crashWrite(w + kRecHdrLen, tag, kCrashTagLen);
+  _crashWrite(w + kRecHdrLen + kCrashTagLen, s, n);
+  w += static_cast<uint32_t>(kRecHdrLen + kCrashTagLen + n);
+  std::atomic_signal_fence(std::memory_order_release); // data before the header
+  s_crashLog.wpos = w;
+  std::atomic_signal_fence(std::memory_order_release);
+  s_crashLog.wposInv = ~w;
+#else
+  (void)hdr; (void)s; (void)n;
+#endif
 }
 
-void AsyncWebConsole::_flushWsBroadcast(bool force){
-  if (!_wsBatch.length()) return;
-  if (_ws.count() == 0) {
-    _wsBatch = "";
-    return;
+// Per-client WebSocket delivery: every client keeps an absolute byte cursor
+// into the backlog ring (_wpos counts every byte ever written, so a cursor
+// older than _wpos - _used has been overwritten). The drain task pumps each
+// client independently whenever its send queue has room.
+int AsyncWebConsole::_wsAttachClient(uint32_t id){
+  for (size_t i = 0; i < _wsMaxClients; i++) {
+    if (_wsClients[i].id == id) return static_cast<int>(i);
   }
-
-  uint32_t now = millis();
-  if (_lastWsFlushMs == 0) _lastWsFlushMs = now;
-
-  bool shouldFlush = force;
-  if (!shouldFlush) {
-    if (_cfg.wsFlushIntervalMs == 0) {
-      shouldFlush = true;
-    } else if ((now - _lastWsFlushMs) >= _cfg.wsFlushIntervalMs) {
-      shouldFlush = true;
-    } else if (_wsBatch.length() >= _cfg.wsBatchMaxBytes) {
-      shouldFlush = true;
+  for (size_t i = 0; i < _wsMaxClients; i++) {
+    if (_wsClients[i].id == 0) {
+      _wsClients[i] = WsClientSlot{id, _wpos, _wpos, 0, 0, true, false, false, false, false, false};
+      return static_cast<int>(i);
     }
   }
+  return -1;
+}
 
-  if (!shouldFlush) {
-    _sendPendingWsDrop(now);
-    return;
+void AsyncWebConsole::_wsDetachClient(uint32_t id){
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < _wsMaxClients; i++) {
+    if (_wsClients[i].id == id) _wsClients[i] = WsClientSlot{};
   }
+  if (_mtx) xSemaphoreGive(_mtx);
+}
 
-  _sendPendingWsDrop(now);
-
-  if (!_ws.availableForWriteAll()) return;
+void AsyncWebConsole::_wsHoldClient(uint32_t id, bool hold){
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < _wsMaxClients; i++) {
+    if (_wsClients[i].id == id) { _wsClients[i].held = hold; _wsClients[i].gen++; }
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (!hold) _wakeDrain();
+}
 
-  _ws.textAll(_wsBatch);
-  _wsBatch = "";
-  _lastWsFlushMs = now;
+// Rewinds a reconnecting client to the mark it last saw ("?since="). False
+// (full replay) for marks from another boot, from the future, or with replay
+// off. Marks that are too old fall to the overrun path: skipped notice, then
+// the oldest full line.
+bool AsyncWebConsole::_wsResume(int slot, const String& since){
+  const char* p = since.c_str();
+  char* end = nullptr;
+  uint32_t epoch = static_cast<uint32_t>(strtoul(p, &end, 16));
+  if (end == p || *end != ':') return false;
+  p = end + 1;
+  uint32_t pos = static_cast<uint32_t>(strtoul(p, &end, 16));
+  if (end == p || *end) return false;
+
+  bool ok = false;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  if (_backlogReplay && _logbuf && epoch == _epoch && static_cast<int32_t>(_wpos - pos) >= 0) {
+    // Text frames may end mid-line and the viewer drops its partial line on
+    // reconnect, so start over at the beginning of that line
+    uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+    if (static_cast<int32_t>(pos - oldest) > 0) {
+      while (pos != oldest && _backlogAt(pos - 1) != '\n') pos--;
+    }
+    WsClientSlot& cs = _wsClients[slot];
+    cs.pos = pos;
+    cs.replayEnd = _wpos;
+    cs.skipped = 0;
+    cs.midLine = false;
+    cs.helpPending = false;
+    cs.gen++;
+    ok = true;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (ok) _wakeDrain();
+  return ok;
 }
 
-void AsyncWebConsole::_queueWsBroadcast(const char* data, size_t len){
-  if (!data || !len) return;
-  if (_ws.count() == 0) return;
+void AsyncWebConsole::_wakeDrain(){
+  if (!_q) return;
+  LogMsg wake{nullptr, false, false, 0, 0, 0};
+  xQueueSend(_q, &wake, 0);
+}
 
-  uint32_t now = millis();
-  if (_lastWsFlushMs == 0) _lastWsFlushMs = now;
+char AsyncWebConsole::_backlogAt(uint32_t pos) const {
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  return _logbuf[(_head + (pos - oldest)) % _bufCap];
+}
 
-  const char* src = data;
-  size_t srcLen = len;
+void AsyncWebConsole::_backlogCopy(uint32_t pos, char* dst, size_t len) const {
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  size_t off = (_head + (pos - oldest)) % _bufCap;
+  size_t first = min(len, _bufCap - off);
+  memcpy(dst, _logbuf + off, first);
+  if (first < len) memcpy(dst + first, _logbuf, len - first);
+}
 
-  bool canSendNow = _ws.availableForWriteAll();
+// Scans walk the (at most two) contiguous ring segments through plain pointers:
+// with the backlog in PSRAM this keeps accesses sequential within cache lines
+// instead of a modulo per byte.
+uint32_t AsyncWebConsole::_backlogFindNl(uint32_t from, uint32_t to) const {
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  size_t off = (_head + (from - oldest)) % _bufCap;
+  size_t len = to - from;
+  size_t first = min(len, _bufCap - off);
+  const char* p = static_cast<const char*>(memchr(_logbuf + off, '\n', first));
+  if (p) return from + static_cast<uint32_t>(p - (_logbuf + off));
+  if (first < len) {
+    p = static_cast<const char*>(memchr(_logbuf, '\n', len - first));
+    if (p) return from + static_cast<uint32_t>(first + (p - _logbuf));
+  }
+  return to;
+}
 
-  if (canSendNow) {
-    _sendPendingWsDrop(now);
-    canSendNow = _ws.availableForWriteAll();
+size_t AsyncWebConsole::_wsChunkLen(uint32_t pos, size_t cap, bool wholeLines) const {
+  size_t avail = _wpos - pos;
+  if (avail <= cap) return avail;
+  if (wholeLines) {
+    // Binary records never split a line: allow one over-long line past cap
+    size_t n = _wsChunkLen(pos, cap, false);
+    if (n < cap || _backlogAt(pos + n - 1) == '\n') return n;
+    uint32_t nl = _backlogFindNl(pos + n, _wpos);
+    return (nl == _wpos ? _wpos : nl + 1) - pos;
+  }
+  // Prefer ending the frame on a line boundary: scan back from pos + cap
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  size_t off = (_head + (pos - oldest)) % _bufCap;
+  size_t first = min(cap, _bufCap - off);
+  if (first < cap) {
+    for (const char* p = _logbuf + (cap - first); p > _logbuf; ) {
+      if (*--p == '\n') return first + static_cast<size_t>(p - _logbuf) + 1;
+    }
+  }
+  for (const char* p = _logbuf + off + first; p > _logbuf + off; ) {
+    if (*--p == '\n') return static_cast<size_t>(p - (_logbuf + off)) + 1;
   }
+  // No newline: cut before a UTF-8 sequence (browsers drop the socket on
+  // invalid text frames), unless that would leave nothing
+  size_t n = cap;
+  while (n > 1 && n + 3 > cap && (static_cast<uint8_t>(_backlogAt(pos + n)) & 0xC0) == 0x80) n--;
+  return (static_cast<uint8_t>(_backlogAt(pos + n)) & 0xC0) == 0x80 ? cap : n;
+}
 
-  if (canSendNow && !_wsBatch.length()) {
-    _ws.textAll(src);
-    _lastWsFlushMs = now;
-    return;
+// Text frame body: record headers become "[HH:MM:SS.mmm] " (or nothing)
+size_t AsyncWebConsole::_backlogRender(uint32_t pos, size_t len, bool lineStart, char* out, Sink* filter) const {
+  uint32_t end = pos + static_cast<uint32_t>(len);
+  size_t n = 0;
+  while (pos != end) {
+    if (lineStart && end - pos >= kRecHdrLen && _backlogAt(pos) == kRecMark) {
+      char hdr[kRecHdrLen];
+      uint32_t ms; uint8_t level; bool fromIdf;
+      _backlogCopy(pos, hdr, kRecHdrLen);
+      if (_recParse(hdr, ms, level, &fromIdf)) {
+        if (filter && !filter->accept(static_cast<esp_log_level_t>(level), fromIdf)) {
+          uint32_t nl = _backlogFindNl(pos, end);
+          pos = nl == end ? end : nl + 1;
+          continue;
+        }
+        if (_cfg.timestamps) {
+          char ts[20];
+          size_t tl = _fmtTimestamp(ms, ts, sizeof(ts));
+          if (out) memcpy(out + n, ts, tl);
+          n += tl;
+        }
+        pos += kRecHdrLen;
+      }
+    }
+    uint32_t nl = _backlogFindNl(pos, end);
+    uint32_t segEnd = nl == end ? end : nl + 1;
+    if (out) _backlogCopy(pos, out + n, segEnd - pos);
+    n += segEnd - pos;
+    pos = segEnd;
+    lineStart = true;
   }
+  return n;
+}
 
-  if (canSendNow && _wsBatch.length()) {
-    _flushWsBroadcast(true);
-    if (_ws.availableForWriteAll()) {
-      _sendPendingWsDrop(now);
-      if (_ws.availableForWriteAll()) {
-        _ws.textAll(src);
-        _lastWsFlushMs = now;
-        return;
+// Binary frame body: one record per line, IDF color wrapping stripped
+size_t AsyncWebConsole::_backlogEncode(uint32_t pos, size_t len, char* out) const {
+  static const char colorDigit[] = { 0, '1', '3', '2', 0, 0 }; // by ESP_LOG_* level
+  uint32_t end = pos + static_cast<uint32_t>(len);
+  uint32_t prevMs = 0;
+  size_t n = 0;
+  while (pos != end) {
+    uint32_t nl = _backlogFindNl(pos, end);
+    uint32_t b = pos, e = nl;
+    uint32_t ms = prevMs;
+    uint8_t level = 0, flags = 0, core = 0;
+    bool fromIdf = false;
+    char tmp[kRecHdrLen];
+    if (e - b >= kRecHdrLen) {
+      _backlogCopy(b, tmp, kRecHdrLen);
+      if (_recParse(tmp, ms, level, &fromIdf, &core)) b += kRecHdrLen;
+    }
+    if (e > b && _backlogAt(e - 1) == '\r') e--;
+    if (level < sizeof(colorDigit) && colorDigit[level] && e - b >= 7) {
+      _backlogCopy(b, tmp, 7);
+      if (!memcmp(tmp, "\x1b[0;3", 5) && tmp[5] == colorDigit[level] && tmp[6] == 'm') {
+        b += 7;
+        flags |= kBinColored;
+        if (e - b >= 4) {
+          _backlogCopy(e - 4, tmp, 4);
+          if (!memcmp(tmp, "\x1b[0m", 4)) e -= 4;
+        }
       }
     }
+    flags |= (level & 7) | (fromIdf ? kBinIdf : 0) | (core ? kBinCore1 : 0);
+    size_t bodyLen = e - b;
+    if (out) out[n] = static_cast<char>(flags);
+    n++;
+    n += _putVarint(out ? out + n : nullptr, ms - prevMs);
+    n += _putVarint(out ? out + n : nullptr, static_cast<uint32_t>(bodyLen));
+    if (out && bodyLen) _backlogCopy(b, out + n, bodyLen);
+    n += bodyLen;
+    prevMs = ms;
+    pos = nl == end ? end : nl + 1;
   }
+  return n;
+}
 
-  if (_cfg.wsBatchMaxBytes == 0){
-    if (!_wsBatch.length() && canSendNow) {
-      _ws.textAll(src);
-      _lastWsFlushMs = now;
-    } else {
-      _wsBatch = String(src);
+// One frame for client c covering [c.pos, c.pos + len), prefixed with the
+// skipped-bytes notice when due
+size_t AsyncWebConsole::_wsFrame(const WsClientSlot& c, size_t len, char* out) const {
+  char note[64];
+  size_t noteLen = 0;
+  if (c.skipped) {
+    int w = snprintf(note, sizeof(note), "%s[AsyncWebConsole] skipped %u bytes%s",
+                     (c.midLine && !c.binary) ? "\n" : "", static_cast<unsigned>(c.skipped),
+                     c.binary ? "" : "\n");
+    noteLen = w > 0 ? min(static_cast<size_t>(w), sizeof(note) - 1) : 0;
+  }
+  char mark[kMarkLen];
+  if (c.marks) _fmtMark(mark, _epoch, c.pos + static_cast<uint32_t>(len));
+  size_t n = 0;
+  if (!c.binary) {
+    if (c.marks) {
+      if (out) { out[0] = kMarkChar; memcpy(out + 1, mark, kMarkLen); out[1 + kMarkLen] = '\n'; }
+      n = kMarkLen + 2;
     }
-    return;
+    if (out && noteLen) memcpy(out + n, note, noteLen);
+    n += noteLen;
+    if (len) n += _backlogRender(c.pos, len, !c.midLine, out ? out + n : nullptr);
+    return n;
+  }
+  if (out) out[0] = static_cast<char>(kBinVersion | (_cfg.timestamps ? kBinTimestamps : 0));
+  n = 1;
+  if (c.marks) {
+    if (out) { out[1] = static_cast<char>(kBinMark); out[2] = 0; out[3] = kMarkLen; memcpy(out + 4, mark, kMarkLen); }
+    n += 3 + kMarkLen;
   }
+  if (noteLen) {
+    if (out) out[n] = static_cast<char>(kBinSys);
+    n++;
+    n += _putVarint(out ? out + n : nullptr, 0);
+    n += _putVarint(out ? out + n : nullptr, static_cast<uint32_t>(noteLen));
+    if (out) memcpy(out + n, note, noteLen);
+    n += noteLen;
+  }
+  if (len) n += _backlogEncode(c.pos, len, out ? out + n : nullptr);
+  return n;
+}
 
-  size_t pendingLen = _wsBatch.length();
-  if (pendingLen + srcLen > _cfg.wsBatchMaxBytes){
-    if (canSendNow) _flushWsBroadcast(true);
-    pendingLen = _wsBatch.length();
-    if (pendingLen + srcLen > _cfg.wsBatchMaxBytes){
-      size_t overflow = (pendingLen + srcLen) - _cfg.wsBatchMaxBytes;
-      _trimWsBatch(overflow);
-      pendingLen = _wsBatch.length();
-      if (srcLen > _cfg.wsBatchMaxBytes){
-        src += (srcLen - _cfg.wsBatchMaxBytes);
-        srcLen = _cfg.wsBatchMaxBytes;
-      }
-      if (pendingLen + srcLen > _cfg.wsBatchMaxBytes){
-        _wsBatch = "";
+// Frame for c as a message buffer, LZ-compressed when negotiated and smaller.
+// nullptr when allocation fails or the frame would exceed maxLen. Channels
+// prefix each frame with their id, so the page can tell them apart.
+AsyncWebSocketMessageBuffer* AsyncWebConsole::_wsBuildFrame(const WsClientSlot& c, size_t len, size_t maxLen){
+  size_t raw = _wsFrame(c, len, nullptr);
+  const size_t pre = _chanId ? 2 : 0;
+  if (c.binary && c.compress && raw > 16 && kLzDictLen + raw < kLzEmpty) {
+    size_t need = kLzDictLen - 1 + raw + _lzBound(raw);
+    if (!_lzTable) _lzTable = static_cast<uint16_t*>(malloc(sizeof(uint16_t) << kLzHashBits));
+    if (_lzCap < need) {
+      free(_lzBuf);
+      _lzBuf = static_cast<uint8_t*>(malloc(need));
+      _lzCap = _lzBuf ? need : 0;
+      if (_lzBuf) memcpy(_lzBuf, kLzDict, kLzDictLen);
+    }
+    if (_lzBuf && _lzTable) {
+      // Records must directly follow the dictionary, so the header byte is
+      // built over the dictionary's last byte and then put back
+      uint8_t* in = _lzBuf + kLzDictLen - 1;
+      uint8_t* lz = in + raw;
+      _wsFrame(c, len, reinterpret_cast<char*>(in));
+      uint8_t hdr = in[0];
+      in[0] = static_cast<uint8_t>(kLzDict[kLzDictLen - 1]);
+      size_t zlen = _lzCompress(_lzBuf, kLzDictLen, kLzDictLen - 1 + raw, lz, _lzTable);
+      size_t total = 1 + _putVarint(nullptr, static_cast<uint32_t>(raw - 1)) + zlen;
+      if (total < raw) {
+        if (pre + total > maxLen) return nullptr;
+        AsyncWebSocketMessageBuffer* buf = _sock().makeBuffer(pre + total);
+        if (!buf) return nullptr;
+        char* o = reinterpret_cast<char*>(buf->get());
+        if (pre) { o[0] = kChanMark; o[1] = static_cast<char>('0' + _chanId); o += pre; }
+        o[0] = static_cast<char>(kBinVersionLz | (hdr & kBinTimestamps));
+        size_t k = 1 + _putVarint(o + 1, static_cast<uint32_t>(raw - 1));
+        memcpy(o + k, lz, zlen);
+        return buf;
       }
     }
   }
+  if (pre + raw > maxLen) return nullptr;
+  AsyncWebSocketMessageBuffer* buf = _sock().makeBuffer(pre + raw);
+  if (!buf) return nullptr;
+  char* o = reinterpret_cast<char*>(buf->get());
+  if (pre) { o[0] = kChanMark; o[1] = static_cast<char>('0' + _chanId); }
+  _wsFrame(c, len, o + pre);
+  return buf;
+}
+
+bool AsyncWebConsole::_pumpOutputs(){
+  bool behind = _pumpWsClients();
+  if (_pumpSinks()) behind = true;
+  return behind;
+}
+
+bool AsyncWebConsole::_pumpWsClients(){
+  _wsPending = false;
+  if (!_logbuf || !_bufCap) return false;
 
-  if (!_wsBatch.concat(src, static_cast<unsigned int>(srcLen))){
-    if (canSendNow) _flushWsBroadcast(true);
-    if (!_wsBatch.concat(src, static_cast<unsigned int>(srcLen))){
-      _wsBatch = String(src);
+  WsClientSlot snap[_wsMaxClients];
+  uint8_t idx[_wsMaxClients];
+  bool gone[_wsMaxClients] = {};
+  size_t n = 0;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < _wsMaxClients; i++) {
+    if (_wsClients[i].id && !_wsClients[i].held) { idx[n] = i; snap[n++] = _wsClients[i]; }
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (!n) return false;
+
+  // _wpos/_used/_head are only modified by this task, so reads need no lock
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  size_t frameCap = _cfg.wsBatchMaxBytes ? _cfg.wsBatchMaxBytes : 1024;
+  if (frameCap < 64) frameCap = 64; // never cut inside a record header
+
+  for (size_t i = 0; i < n; i++) {
+    WsClientSlot& c = snap[i];
+    if (static_cast<int32_t>(oldest - c.pos) > 0) {
+      // Overwritten while the client was slow: resume at the next full line
+      uint32_t before = c.skipped;
+      c.skipped += oldest - c.pos;
+      c.pos = oldest;
+      uint32_t nl = _backlogFindNl(oldest, _wpos);
+      if (nl != _wpos) { c.skipped += nl + 1 - c.pos; c.pos = nl + 1; }
+      _stats.wsSkipped.fetch_add(c.skipped - before, std::memory_order_relaxed);
     }
   }
 
-  if (canSendNow) {
-    _flushWsBroadcast(true);
+  // Fast path: all clients at the same live cursor with room to send share one frame
+  bool more = false;
+  AsyncWebSocket& ws = _sock();
+  bool shared = (ws.count() == n) && ws.availableForWriteAll();
+  for (size_t i = 0; shared && i < n; i++) {
+    if (snap[i].pos != snap[0].pos || snap[i].skipped || snap[i].helpPending ||
+        snap[i].binary != snap[0].binary || snap[i].compress != snap[0].compress ||
+        snap[i].midLine != snap[0].midLine || snap[i].marks != snap[0].marks) shared = false;
+  }
+  if (shared) {
+    for (int frames = 0; frames < 4; frames++) {
+      size_t len = _wsChunkLen(snap[0].pos, frameCap, snap[0].binary);
+      if (!len || !ws.availableForWriteAll()) break;
+      if (_wpos - snap[0].pos > frameCap) { more = true; if (frames) break; }
+      AsyncWebSocketMessageBuffer* buf = _wsBuildFrame(snap[0], len, SIZE_MAX);
+      if (!buf) break;
+      bool nl = _backlogAt(snap[0].pos + len - 1) == '\n';
+      if (snap[0].binary) ws.binaryAll(buf);
+      else ws.textAll(buf);
+      for (size_t i = 0; i < n; i++) { snap[i].pos += len; snap[i].midLine = !nl; }
+    }
   } else {
-    _flushWsBroadcast(false);
+    for (size_t i = 0; i < n; i++) {
+      WsClientSlot& c = snap[i];
+      AsyncWebSocketClient* cli = ws.client(c.id);
+      if (!cli) { gone[i] = true; continue; }
+      for (int frames = 0; frames < 4 && cli->canSend(); frames++) {
+        // Catching up (backlog replay, slow link): one frame at a time, and only
+        // once the TCP window has room for it, so queued memory stays O(frame)
+        bool catchingUp = (_wpos - c.pos) > frameCap;
+        if (catchingUp) more = true;
+        if (catchingUp && frames) break;
+        size_t len = _wsChunkLen(c.pos, frameCap, c.binary);
+        if (!len && !c.skipped) break;
+        AsyncClient* tcp = cli->client();
+        AsyncWebSocketMessageBuffer* buf = nullptr;
+        if (catchingUp && tcp) {
+          // Size the chunk to the window (less the WebSocket header): a frame
+          // larger than the TCP send buffer would never fit. Text rendering
+          // grows records, so halve the chunk until the frame fits.
+          size_t room = tcp->space() > 10 ? tcp->space() - 10 : 0;
+          for (size_t cap = min(frameCap, room); cap >= 64 && !buf; cap /= 2) {
+            len = _wsChunkLen(c.pos, cap, c.binary);
+            buf = _wsBuildFrame(c, len, room);
+          }
+        } else {
+          buf = _wsBuildFrame(c, len, SIZE_MAX);
+        }
+        if (!buf) break;
+        if (len) c.midLine = _backlogAt(c.pos + len - 1) != '\n';
+        if (c.binary) cli->binary(buf);
+        else cli->text(buf);
+        c.pos += len;
+        c.skipped = 0;
+      }
+      // Help goes out once the replayed backlog has been queued
+      if (c.helpPending && static_cast<int32_t>(c.pos - c.replayEnd) >= 0 && cli->canSend()) {
+        String ht = helpText();
+        if (ht.length()) cli->text(ht);
+        c.helpPending = false;
+      }
+    }
+  }
+
+  // Write cursors back unless the slot was reset meanwhile (sendBacklog, reconnect)
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < n; i++) {
+    WsClientSlot& slot = _wsClients[idx[i]];
+    if (slot.id != snap[i].id || slot.gen != snap[i].gen) continue;
+    if (gone[i]) { slot = WsClientSlot{}; continue; }
+    slot.pos = snap[i].pos;
+    slot.skipped = snap[i].skipped;
+    slot.midLine = snap[i].midLine;
+    slot.helpPending = snap[i].helpPending;
+    if (slot.pos != _wpos || slot.helpPending) _wsPending = true;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  return more;
+}
+
+// Output sinks: like WebSocket clients, each one reads the backlog ring from
+// its own cursor. Lines it has not taken yet sit in the ring (or, once rendered,
+// in its pending buffer), so a slow sink never holds up the others.
+bool AsyncWebConsole::addSink(Sink* sink, SinkPolicy policy, uint32_t blockMs){
+  if (!sink || !_logbuf) return false;
+  return _addSinkSlot(sink, policy, blockMs, true);
+}
+
+void AsyncWebConsole::removeSink(Sink* sink){
+  if (!sink || sink == _mirrorSink || sink == _fileSink) return;
+  if (_sinkMtx) xSemaphoreTake(_sinkMtx, portMAX_DELAY);
+  for (size_t i = 0; i < _sinkCount; i++) {
+    if (_sinks[i].sink != sink) continue;
+    free(_sinks[i].buf);
+    for (size_t j = i + 1; j < _sinkCount; j++) _sinks[j - 1] = _sinks[j];
+    _sinks[--_sinkCount] = SinkSlot{};
+    break;
+  }
+  if (_sinkMtx) xSemaphoreGive(_sinkMtx);
+}
+
+bool AsyncWebConsole::_addSinkSlot(Sink* sink, SinkPolicy policy, uint32_t blockMs, bool live){
+  // Lock order is _mtx then _sinkMtx (the drain task publishes under _mtx),
+  // so read the cursor before taking the sink lock
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  uint32_t pos = live ? _wpos : _wpos - static_cast<uint32_t>(_used);
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (_sinkMtx) xSemaphoreTake(_sinkMtx, portMAX_DELAY);
+  bool ok = _sinkCount < _maxSinks;
+  for (size_t i = 0; ok && i < _sinkCount; i++) {
+    if (_sinks[i].sink == sink) ok = false;
+  }
+  if (ok) _sinks[_sinkCount++] = SinkSlot{sink, pos, 0, blockMs, policy, nullptr, 0, 0, 0};
+  if (_sinkMtx) xSemaphoreGive(_sinkMtx);
+  return ok;
+}
+
+bool AsyncWebConsole::_pumpSinks(){
+  _sinksPending = false;
+  if (!_logbuf || !_bufCap) return false;
+  // A sink that made progress but has more is polled fast; one that took
+  // nothing (busy, offline) waits for the regular retry interval
+  bool progress = false;
+  if (_sinkMtx) xSemaphoreTake(_sinkMtx, portMAX_DELAY);
+  for (size_t i = 0; i < _sinkCount; i++) {
+    SinkSlot& sl = _sinks[i];
+    uint32_t pos = sl.pos;
+    size_t off = sl.off, len = sl.len;
+    if (!_pumpSink(sl)) continue;
+    _sinksPending = true;
+    if (sl.pos != pos || sl.off != off || sl.len != len) progress = true;
   }
+  if (_sinkMtx) xSemaphoreGive(_sinkMtx);
+  return progress;
 }
 
-void AsyncWebConsole::_sendPendingWsDrop(uint32_t now){
-  if (!_wsDropPending || !_wsDropMessage.length()) return;
-  if (!_ws.availableForWriteAll()) return;
+bool AsyncWebConsole::_pumpSink(SinkSlot& s){
+  // _wpos/_used are only modified by the drain task, which is the caller
+  uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+  size_t chunk = _cfg.wsBatchMaxBytes ? _cfg.wsBatchMaxBytes : 1024;
+  for (int rounds = 0; rounds < 8; rounds++) {
+    if (s.off < s.len) {
+      size_t w = s.sink->write(s.buf + s.off, s.len - s.off);
+      s.off += min(w, s.len - s.off);
+      if (s.off < s.len) return true;
+    }
+    s.off = s.len = 0;
+
+    if (static_cast<int32_t>(oldest - s.pos) > 0) {
+      // Overwritten before the sink took it: resume at the next full line
+      uint32_t before = s.skipped;
+      s.skipped += oldest - s.pos;
+      s.pos = oldest;
+      uint32_t nl = _backlogFindNl(oldest, _wpos);
+      if (nl != _wpos) { s.skipped += nl + 1 - s.pos; s.pos = nl + 1; }
+      _stats.sinkSkipped.fetch_add(s.skipped - before, std::memory_order_relaxed);
+    }
+    char note[48];
+    size_t noteLen = 0;
+    if (s.skipped) {
+      int k = snprintf(note, sizeof(note), "[AsyncWebConsole] skipped %u bytes\n", static_cast<unsigned>(s.skipped));
+      noteLen = k > 0 ? min(static_cast<size_t>(k), sizeof(note) - 1) : 0;
+    }
+    size_t src = _wsChunkLen(s.pos, chunk, true);
+    if (!src && !noteLen) return false;
+
+    size_t need = noteLen + (src ? _backlogRender(s.pos, src, true, nullptr, s.sink) : 0);
+    if (need > s.cap) {
+      char* nb = static_cast<char*>(realloc(s.buf, need));
+      if (!nb) return true; // retry on the next pump
+      s.buf = nb;
+      s.cap = need;
+    }
+    if (noteLen) memcpy(s.buf, note, noteLen);
+    if (src) _backlogRender(s.pos, src, true, s.buf + noteLen, s.sink);
+    s.len = need;
+    s.pos += static_cast<uint32_t>(src);
+    s.skipped = 0;
+  }
+  return s.off < s.len || s.pos != _wpos;
+}
 
-  _ws.textAll(_wsDropMessage);
-  _wsDropPending = false;
-  _wsDropMessage = "";
-  _lastWsFlushMs = now;
+void AsyncWebConsole::_sinksMakeRoom(size_t n){
+  if (!_bufCap || n > _bufCap || !_sinkCount) return;
+  if (_sinkMtx) xSemaphoreTake(_sinkMtx, portMAX_DELAY);
+  for (size_t i = 0; i < _sinkCount; i++) {
+    SinkSlot& s = _sinks[i];
+    uint32_t blockMs = s.policy == SinkPolicy::Block ? s.blockMs : 0;
+    if (s.sink == _mirrorSink) blockMs = _cfg.mirrorBlockMs;
+    else if (s.sink == _fileSink) blockMs = _cfg.fileBlockMs;
+    if (!blockMs) continue;
+    // Bytes from s.pos survive the push while _wpos + n - s.pos <= _bufCap
+    uint32_t start = millis();
+    while (static_cast<size_t>(_wpos + n - s.pos) > _bufCap) {
+      _pumpSink(s);
+      if (static_cast<size_t>(_wpos + n - s.pos) <= _bufCap || millis() - start >= blockMs) break;
+      vTaskDelay(1);
+    }
+  }
+  if (_sinkMtx) xSemaphoreGive(_sinkMtx);
+}
+
+// Broadcast through one shared AsyncWebSocketMessageBuffer: every client queue
+// references the same payload, so a flush costs O(len) regardless of client count.
+bool AsyncWebConsole::_wsTextAll(const char* a, size_t alen, const char* b, size_t blen){
+  if (!b) blen = 0;
+  if (!a) alen = 0;
+  if (!alen && !blen) return true;
+  if (_wsHost) return true; // channels only reach the page through the ring
+  AsyncWebSocketMessageBuffer* buf = _ws.makeBuffer(alen + blen);
+  if (!buf) return false;
+  if (alen) memcpy(buf->get(), a, alen);
+  if (blen) memcpy(buf->get() + alen, b, blen);
+  _ws.textAll(buf);
+  return true;
 }
 
 void AsyncWebConsole::setIndexHtml(const char* htmlProgmem){
@@ -416,25 +2157,38 @@ void AsyncWebConsole::setConfig(const Config& cfg){
   bool wasEnabled = (_task != nullptr);
   if (wasEnabled) _stopDrainTask();
 
-  _flushWsBroadcast(true);
-
+  _pumpOutputs();
+
+  bool capsChanged = cfg.bufferCaps != _cfg.bufferCaps;
+  // File buffers are re-created for the new settings on the next line
+  _fileFlush(true);
+  _fileStopTask();
+  _fileClose();
+  free(_fileBuf[0]);
+  free(_fileBuf[1]);
+  _fileBuf[0] = _fileBuf[1] = nullptr;
+  _fileBufCap = 0;
+  _fileFill = 0;
+  _fileActive = 0;
+  _udpFlush();
+  _udpReset();
+  if (cfg.mirrorOut != _cfg.mirrorOut) _mirrorSawRoom = false;
   _cfg = cfg;
 
-  _wsBatch = "";
-  _lastWsFlushMs = millis();
-
   // Drain remaining messages before destroying the queue
   if (_q) {
     LogMsg msg;
     while (xQueueReceive(_q, &msg, 0) == pdTRUE) {
-      if (msg.data) {
-        _processLine(msg.data);
-        free(msg.data);
-      }
+      if (!msg.data) continue;
+      _sinksMakeRoom(_msgRoom(msg));
+      if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+      _handleMsg(msg);
+      if (_mtx) xSemaphoreGive(_mtx);
     }
     vQueueDelete(_q);
     _q = nullptr;
   }
+  if (capsChanged || _ringCap != (_cfg.ringBytes & ~static_cast<size_t>(3))) _ringInit(_cfg.ringBytes);
   _q = xQueueCreate(_cfg.queueLen, sizeof(LogMsg));
 
   if (wasEnabled) _startDrainTask();
@@ -460,60 +2214,224 @@ void AsyncWebConsole::setTagLogLevel(const char* tag, esp_log_level_t level){
   if (tag && *tag) esp_log_level_set(tag, level);
 }
 
-void AsyncWebConsole::setMirrorSerial(Print* out){ _cfg.mirrorOut = out; }
+void AsyncWebConsole::setMirrorSerial(Print* out){
+  if (out != _cfg.mirrorOut) _mirrorSawRoom = false;
+  _cfg.mirrorOut = out;
+}
 
 void AsyncWebConsole::_onWsEvent(AsyncWebSocket *srv, AsyncWebSocketClient *cli,
                                  AwsEventType type, void *arg, uint8_t *data, size_t len)
 {
+  (void)srv;
   if (type == WS_EVT_CONNECT) {
-    // Send banner with newline so next output starts on a new line
+    // Binary frames are opt-in per client via the upgrade request's query
+    // (browsers fail the handshake on an unanswered subprotocol, so no
+    // Sec-WebSocket-Protocol negotiation here)
+    AsyncWebServerRequest* req = static_cast<AsyncWebServerRequest*>(arg);
+    bool binary = _cfg.wsBinary && req && req->hasParam("bin");
+    bool compress = binary && _cfg.wsCompress && req->hasParam("lz");
+    bool marks = req && req->hasParam("resume");
+    // Channels to send: "?ch=0,2" (bit n = channel n), this console only by default
+    uint32_t chMask = 1;
+    const AsyncWebParameter* ch = (req && _chanCount) ? req->getParam("ch") : nullptr;
+    if (ch) {
+      chMask = 0;
+      for (const char* p = ch->value().c_str(); *p; ++p) {
+        if (*p >= '0' && *p <= static_cast<char>('0' + kMaxChannels)) chMask |= 1u << (*p - '0');
+      }
+    }
     cli->setCloseClientOnQueueFull(false);
-    cli->text("== AsyncWebConsole connected ==\n");
-    sendBacklog(cli);
-    String ht = helpText(); if (ht.length()) cli->text(ht);
-    _flushWsBroadcast(true);
+    if (chMask & 1) {
+      // Track the client held (no live output) until banner, backlog and help are queued
+      if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+      int slot = _wsAttachClient(cli->id());
+      if (_mtx) xSemaphoreGive(_mtx);
+      if (slot < 0) {
+        cli->text("== AsyncWebConsole: too many clients ==\n");
+        cli->close();
+        return;
+      }
+      if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+      _wsClients[slot].binary = binary;
+      _wsClients[slot].compress = compress;
+      _wsClients[slot].marks = marks;
+      if (_mtx) xSemaphoreGive(_mtx);
+      // Send banner with newline so next output starts on a new line
+      cli->text("== AsyncWebConsole connected ==\n");
+      // A reconnecting viewer only gets what it missed (help was shown already)
+      const AsyncWebParameter* since = req ? req->getParam("since") : nullptr;
+      if (!since || !_wsResume(slot, since->value())) {
+        if (_prevBoot && !_prevBootSent) {
+          // Shown once; later viewers find it at <routePath>/prevboot
+          _prevBootSent = true;
+          cli->text(_prevBoot, _prevBootLen);
+          cli->text("== end of previous boot ==\n");
+        }
+        sendBacklog(cli);
+        if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+        _wsClients[slot].helpPending = true;
+        if (_mtx) xSemaphoreGive(_mtx);
+      }
+      _wsHoldClient(cli->id(), false);
+    }
+    // Then the subscribed channels (their own history and resume marks); the
+    // table lock keeps a channel from being destroyed while it sends
+    if (chMask >> 1) {
+      if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+      for (size_t i = 0; i < kMaxChannels; ++i) {
+        if (!(chMask & (2u << i)) || !_channels[i]) continue;
+        char key[8];
+        snprintf(key, sizeof(key), "since%u", static_cast<unsigned>(i + 1));
+        _channels[i]->_wsChannelJoin(cli, binary, compress, marks, req->getParam(key));
+      }
+      if (_mtx) xSemaphoreGive(_mtx);
+    }
+    return;
+  }
+  if (type == WS_EVT_DISCONNECT) {
+    _wsDetachClient(cli->id());
+    if (_chanCount) {
+      if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+      for (size_t i = 0; i < kMaxChannels; ++i) {
+        if (_channels[i]) _channels[i]->_wsDetachClient(cli->id());
+      }
+      if (_mtx) xSemaphoreGive(_mtx);
+    }
     return;
   }
   if (type == WS_EVT_DATA) {
     AwsFrameInfo* info = (AwsFrameInfo*)arg;
     if (info->final && info->index==0 && info->len==len && info->opcode==WS_TEXT) {
-      String cmd; cmd.reserve(len+1);
-      for (size_t i=0;i<len;i++) cmd += (char)data[i];
-      print("> " + cmd);
-      String out = dispatch(cmd);
-      if (out.length()) print(out);
+      if (len >= _cmdLineMax) { cli->text("command too long\n"); return; }
+      if (_cfg.cmdQueueLen) {
+        // Handlers run on the command task, never on AsyncTCP
+        if (!_cmdPost(cli->id(), data, len)) cli->text("busy: too many commands waiting\n");
+        return;
+      }
+      char line[_cmdLineMax];
+      memcpy(line, data, len);
+      line[len] = '\0';
+      _cmdRun(cli->id(), String(line));
     }
   }
 }
 
+// A host's client subscribing to this channel: same flow as a direct connect,
+// minus banner and help (the host sends those on channel 0)
+void AsyncWebConsole::_wsChannelJoin(AsyncWebSocketClient* cli, bool binary, bool compress,
+                                     bool marks, const AsyncWebParameter* since){
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  int slot = _wsAttachClient(cli->id());
+  if (slot >= 0) {
+    _wsClients[slot].binary = binary && _cfg.wsBinary;
+    _wsClients[slot].compress = compress && _cfg.wsCompress;
+    _wsClients[slot].marks = marks;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (slot < 0) {
+    ESP_LOGW(TAG, "Channel %u: too many clients", static_cast<unsigned>(_chanId));
+    return;
+  }
+  if (!since || !_wsResume(slot, since->value())) sendBacklog(cli);
+  _wsHoldClient(cli->id(), false);
+}
+
+bool AsyncWebConsole::addChannel(AsyncWebConsole& channel, const char* name){
+  if (&channel == this || _wsHost || channel._wsHost || channel._chanCount) return false;
+  bool added = false;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  for (size_t i = 0; i < kMaxChannels && !added; ++i) {
+    if (_channels[i]) continue;
+    _channels[i] = &channel;
+    _chanNames[i] = name ? name : channel._cfg.channelName;
+    _chanCount++;
+    channel._chanId = static_cast<uint8_t>(i + 1);
+    channel._wsHost = this;
+    added = true;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  if (added) return true;
+  ESP_LOGW(TAG, "addChannel: all %u channels in use", static_cast<unsigned>(kMaxChannels));
+  return false;
+}
+
 int AsyncWebConsole::_idfVprintfShim(const char* fmt, va_list ap){
-  // Passthrough: forward to original vprintf (preserves UART output)
+  // Passthrough: forward to original vprintf once (preserves UART output)
+  bool pass = false, ready = false;
+  for (size_t i = 0; i < kMaxBridges; ++i) {
+    AsyncWebConsole* b = _bridges[i];
+    if (!b) continue;
+    pass |= b->_cfg.idfPassthrough;
+    ready |= b->_q != nullptr;
+  }
   int origLen = 0;
-  if (_sink && _sink->_cfg.idfPassthrough && _origVprintf) {
+  if (pass && _origVprintf) {
     va_list ap2; va_copy(ap2, ap);
     origLen = _origVprintf(fmt, ap2);
     va_end(ap2);
   }
 
   // Bridge not ready: return length only
-  if (!_sink || !_sink->_q) {
+  if (!ready) {
     if (origLen) return origLen;
     va_list ap2; va_copy(ap2, ap);
-    int n = vsnprintf(nullptr, 0, fmt, ap2);
+    int n = vsnprintf(nullptr, 0, fmt, ap2);
+    va_end(ap2);
+    return n > 0 ? n : 0;
+  }
+
+  // Each bridged console applies its own filters and keeps its own copy
+  int len = 0;
+  for (size_t i = 0; i < kMaxBridges; ++i) {
+    AsyncWebConsole* b = _bridges[i];
+    if (!b || !b->_q) continue;
+    va_list ap2; va_copy(ap2, ap);
+    int n = b->_bridgeLine(fmt, ap2);
     va_end(ap2);
-    return n > 0 ? n : 0;
+    if (n > len) len = n;
+  }
+  return origLen ? origLen : len;
+}
+
+int AsyncWebConsole::_bridgeLine(const char* fmt, va_list ap){
+  // The level is visible in the format: read it once here, so filtered lines
+  // are never formatted and the drain task doesn't parse it again
+  esp_log_level_t lvl = _detectEspLogLevel(fmt);
+  if (!_allowLevel(fmt, lvl)) { _stats.filtered.fetch_add(1, std::memory_order_relaxed); return 0; }
+  uint8_t known = lvl == ESP_LOG_NONE ? kLevelUnknown : static_cast<uint8_t>(lvl); // "%s" formats: look at the text
+  if (_cfg.rateLimitPerSec) {
+    uint32_t dropped = 0;
+    if (!_rateAdmit(fmt, dropped)) { _stats.rateLimited.fetch_add(1, std::memory_order_relaxed); return 0; }
+    if (dropped) {
+      char* note = _allocLine(80);
+      if (note) {
+        snprintf(note, 80, "[AsyncWebConsole] rate limit: %u lines like the next one dropped\n", static_cast<unsigned>(dropped));
+        _enqueueRaw(note, true);
+      }
+    }
+  }
+
+  // Deferred path: capture args only
+  if (_cfg.deferredFormat) {
+    char* rec = _captureDeferred(fmt, ap);
+    if (rec) {
+      _enqueueRaw(rec, true, true, known);
+      return 0;
+    }
   }
 
   // Normal path: enqueue for WebSocket / backlog / file
-  char * s = _vsformat(fmt, _sink->_cfg.maxLineLen, ap);
-  if (!s) return origLen;
+  char * s = _formatLine(fmt, ap);
+  if (!s) return 0;
   int len = strlen(s);
-  if (_sink->_allowSyslog(s)) {
-    if (!_sink->_enqueueRaw(s, true)) return origLen;
+  if (known == kLevelUnknown) { lvl = _detectEspLogLevel(s); known = static_cast<uint8_t>(lvl); }
+  if (_allowLevel(s, lvl)) { // the tag is only in the formatted line
+    if (!_enqueueRaw(s, true, false, known)) return 0;
   } else {
-    free(s);
+    _freeLine(s);
+    _stats.filtered.fetch_add(1, std::memory_order_relaxed);
   }
-  return origLen ? origLen : len;
+  return len;
 }
 
 void AsyncWebConsole::_startDrainTask(){
@@ -521,7 +2439,7 @@ void AsyncWebConsole::_startDrainTask(){
   xTaskCreatePinnedToCore(_drainTask, "awc_drain",
                           _cfg.taskStack, this,
                           _cfg.taskPrio, &_task,
-                          tskNO_AFFINITY);
+                          _cfg.taskCore);
 }
 
 void AsyncWebConsole::_stopDrainTask(){
@@ -531,7 +2449,7 @@ void AsyncWebConsole::_stopDrainTask(){
 
   // Try to send sentinel to unblock the task if waiting on empty queue.
   // If queue is full, drain task will notice _shutdownRequested on its next iteration.
-  LogMsg sentinel{nullptr};
+  LogMsg sentinel{nullptr, false, false, 0, 0, 0};
   xQueueSend(_q, &sentinel, pdMS_TO_TICKS(50));
 
   // Wait for the task to exit cooperatively (up to 2 seconds)
@@ -553,51 +2471,84 @@ void AsyncWebConsole::_drainTask(void* arg){
   auto* self = static_cast<AsyncWebConsole*>(arg);
   while (!self->_shutdownRequested) {
     LogMsg msg;
+    // Idle (nothing unsent anywhere): block until the next line or wakeup
     TickType_t waitTicks = portMAX_DELAY;
-    if (self->_cfg.wsFlushIntervalMs){
+    if ((self->_wsPending || self->_sinksPending) && self->_cfg.wsFlushIntervalMs){
       waitTicks = pdMS_TO_TICKS(self->_cfg.wsFlushIntervalMs);
       if (waitTicks == 0) waitTicks = 1;
     }
-    if (xQueueReceive(self->_q, &msg, waitTicks) == pdTRUE){
-      if (!msg.data) continue;  // sentinel — recheck shutdown flag
-      if (self->_shutdownRequested) { free(msg.data); break; }
-      size_t len = strlen(msg.data);
-      if (len && msg.data[len - 1] != '\n') {
-        char* extended = static_cast<char*>(realloc(msg.data, len + 2));
-        if (extended) {
-          extended[len] = '\n';
-          extended[len + 1] = '\0';
-          msg.data = extended;
-        }
-      }
-      self->_processLine(msg.data, msg.fromIdf);
-      free(msg.data);
+    // A client or sink is behind: poll it more often
+    if (self->_outputsBehind) {
+      TickType_t fast = pdMS_TO_TICKS(5);
+      if (fast == 0) fast = 1;
+      if (fast < waitTicks) waitTicks = fast;
+    }
+    // Buffered file/syslog data must not wait longer than its flush interval
+    if (self->_fileFill) {
+      TickType_t due = _ticksUntil(self->_fileFirstMs, self->_cfg.fileFlushMs);
+      if (due < waitTicks) waitTicks = due;
+    }
+    if (self->_udpLen) {
+      uint32_t flushMs = self->_cfg.udpFlushMs ? self->_cfg.udpFlushMs : self->_cfg.wsFlushIntervalMs;
+      TickType_t due = _ticksUntil(self->_udpFirstMs, flushMs);
+      if (due < waitTicks) waitTicks = due;
+    }
+    if (self->_repCount) {
+      TickType_t due = _ticksUntil(self->_repFirstMs, self->_cfg.repeatFlushMs);
+      if (due < waitTicks) waitTicks = due;
+    }
+    BaseType_t got = xQueueReceive(self->_q, &msg, waitTicks);
+    uint32_t woke = micros();
+    // A null message is a wakeup/sentinel: pump like a timeout, then the loop
+    // condition rechecks the shutdown flag
+    if (got == pdTRUE && msg.data){
+      if (self->_shutdownRequested) { self->_freeLine(msg.data); break; }
+      uint32_t waiting = static_cast<uint32_t>(uxQueueMessagesWaiting(self->_q)) + 1;
+      if (waiting > self->_stats.queueHigh.load(std::memory_order_relaxed)) self->_stats.queueHigh.store(waiting, std::memory_order_relaxed);
+      self->_handleBatch(msg);
     } else {
-      self->_flushWsBroadcast(false);
+      self->_outputsBehind = self->_pumpOutputs();
     }
+    self->_fileTick();
+    self->_udpTick();
+    self->_repeatTick();
+    self->_drainBusyUs.fetch_add(micros() - woke, std::memory_order_relaxed);
   }
-  // Final flush before exit
-  self->_flushWsBroadcast(true);
+  // Final flush before exit; give slow sinks a moment to take what is left
+  self->_pumpWsClients();
+  for (int i = 0; i < 50 && self->_pumpSinks(); i++) vTaskDelay(pdMS_TO_TICKS(2));
+  self->_udpFlush();
+  self->_fileFlush(true);
   self->_task = nullptr;
   vTaskDelete(nullptr);
 }
 
 void AsyncWebConsole::enableEspLogBridge(){
-  if (_sink && _sink != this) {
-    Serial.println(F("[AsyncWebConsole] WARNING: esp_log bridge reassigned from another instance"));
+  // Several consoles may share the hook; each gets every line
+  size_t slot = kMaxBridges;
+  for (size_t i = 0; i < kMaxBridges; ++i) {
+    if (_bridges[i] == this) return;
+    if (!_bridges[i] && slot == kMaxBridges) slot = i;
+  }
+  if (slot == kMaxBridges) {
+    Serial.println(F("[AsyncWebConsole] WARNING: esp_log bridge has no free slot"));
+    return;
   }
-  _sink = this;
+  _bridges[slot] = this;
   if (!_origVprintf) _origVprintf = esp_log_set_vprintf(&_idfVprintfShim);
   else               esp_log_set_vprintf(&_idfVprintfShim);
 }
 
 void AsyncWebConsole::disableEspLogBridge(){
-  if (_sink == this) {
-    if (_origVprintf) {
-      esp_log_set_vprintf(_origVprintf);
-      _origVprintf = nullptr;
-    }
-    _sink = nullptr;
+  bool found = false, others = false;
+  for (size_t i = 0; i < kMaxBridges; ++i) {
+    if (_bridges[i] == this) { _bridges[i] = nullptr; found = true; }
+    else if (_bridges[i]) others = true;
+  }
+  // The last one out restores the original writer
+  if (found && !others && _origVprintf) {
+    esp_log_set_vprintf(_origVprintf);
+    _origVprintf = nullptr;
   }
 }
 
@@ -609,53 +2560,58 @@ void AsyncWebConsole::setEspLogBridge(bool enable){
 // (removed installEarlyLogHook; enableEspLogBridge() should be called in setup())
 
 // ets_printf bridge
-void AsyncWebConsole::_etsPutcHook(char c){
-  // Collect characters into a static line buffer under spinlock,
-  // then copy out and do malloc/enqueue OUTSIDE the critical section.
-  static char lbuf[256];
-  static size_t li = 0;
-
-  char outbuf[258];
-  size_t outLen = 0;
-  bool doSend = false;
-
-#if defined(ARDUINO_ARCH_ESP32)
-  static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
-  portENTER_CRITICAL(&mux);
-#endif
+// One line accumulator per core, so ROM prints from the two cores never mix.
+// Masking interrupts on the local core keeps an ISR or a preempting task from
+// interleaving with a half-built line; the other core never touches this
+// core's buffer, so no lock is shared between them.
+struct EtsLineBuf { char buf[256]; size_t len; };
+static EtsLineBuf s_etsLine[portNUM_PROCESSORS];
 
-  if (li < sizeof(lbuf) - 1) lbuf[li++] = c;
-  if (c == '\n' || li >= sizeof(lbuf) - 1) {
-    memcpy(outbuf, lbuf, li);
-    outLen = li;
-    li = 0;
-    doSend = true;
+void AsyncWebConsole::_etsPutcHook(char c){
+  char line[sizeof(EtsLineBuf::buf) + 1];
+  size_t li;
+  UBaseType_t irq = portSET_INTERRUPT_MASK_FROM_ISR();
+  EtsLineBuf& lb = s_etsLine[xPortGetCoreID() % portNUM_PROCESSORS];
+  li = lb.len;
+  if (li < sizeof(lb.buf) - 1) lb.buf[li++] = c;
+  if (c != '\n' && li < sizeof(lb.buf) - 1) {
+    lb.len = li;
+    portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+    return;
   }
-
-#if defined(ARDUINO_ARCH_ESP32)
-  portEXIT_CRITICAL(&mux);
-#endif
-
-  if (doSend && outLen) {
-    // Ensure newline termination
-    if (outbuf[outLen - 1] != '\n') { outbuf[outLen++] = '\n'; }
-    outbuf[outLen] = '\0';
-
-    char* buf = (char*)malloc(outLen + 1);
-    if (buf) {
-      memcpy(buf, outbuf, outLen + 1);
-      if (_sink && _sink->_q) _sink->_enqueueRaw(buf); else free(buf);
-    }
+  memcpy(line, lb.buf, li);
+  lb.len = 0;
+  portCLEAR_INTERRUPT_MASK_FROM_ISR(irq);
+
+  // Whole line: one reservation in the producer ring (when configured); the
+  // newline is added if the line was cut at the buffer size.
+  // Into the instance that enabled this bridge, else the first esp_log one
+  AsyncWebConsole* sink = _etsSink;
+  for (size_t i = 0; !sink && i < kMaxBridges; ++i) sink = _bridges[i];
+  if (!sink || !sink->_q) return;
+  if (!sink->_ring && _inIsr()) {
+    // No malloc in an ISR: without a producer ring the line is lost
+    sink->_stats.droppedNoMem.fetch_add(1, std::memory_order_relaxed);
+    return;
   }
+  bool nl = line[li - 1] == '\n';
+  char* out = sink->_allocLine(li + (nl ? 1 : 2));
+  if (!out) return;
+  memcpy(out, line, li);
+  if (!nl) out[li++] = '\n';
+  out[li] = '\0';
+  sink->_enqueueRaw(out);
 }
 
 void AsyncWebConsole::enableEtsPrintfBridge(){
+  _etsSink = this;
 #if defined(AWC_HAVE_ETSPUTC)
   ets_install_putc1(&_etsPutcHook);
 #endif
 }
 
 void AsyncWebConsole::disableEtsPrintfBridge(){
+  if (_etsSink == this) _etsSink = nullptr;
 #if defined(AWC_HAVE_ROM_PRINTF)
   // Restore default ROM UART printf
   esp_rom_install_uart_printf();
@@ -676,6 +2632,7 @@ void AsyncWebConsole::enableFileLog(const char* path, size_t maxSize, uint8_t ma
 
 void AsyncWebConsole::disableFileLog(){
   _cfg.fileLogEnable = false;
+  _wakeDrain(); // the drain task closes the file
 }
 
 void AsyncWebConsole::setFileLog(bool enable, const char* path, size_t maxSize, uint8_t maxFiles){
@@ -697,10 +2654,11 @@ size_t AsyncWebConsole::_currentFileSize(){
 #endif
 }
 
-void AsyncWebConsole::_rotateIfNeeded(){
+void AsyncWebConsole::_rotateIfNeeded(size_t incoming){
 #if defined(AWC_HAS_LITTLEFS) || defined(AWC_HAS_SPIFFS)
-  size_t s = _currentFileSize();
-  if (s <= _cfg.maxFileSize) return;
+  size_t s = _file ? _fileSize : _currentFileSize();
+  if (!s || s + incoming <= _cfg.maxFileSize) return;
+  _fileClose();
 
   auto doExists = [&](const String& p)->bool{
 #if defined(AWC_HAS_LITTLEFS)
@@ -735,47 +2693,685 @@ void AsyncWebConsole::_rotateIfNeeded(){
   String to1 = String(_cfg.filePath) + ".1";
   if (doExists(to1)) doRemove(to1);
   doRename(String(_cfg.filePath), to1);
+#else
+  (void)incoming;
 #endif
 }
 
-void AsyncWebConsole::_appendToFile(const char* data, size_t len){
-  if (!_cfg.fileLogEnable) return;
+// Writes one batch to the log file, keeping it open between batches. Runs on
+// the drain task, or on the file task with Config::fileTask.
+void AsyncWebConsole::_fileWrite(const char* data, size_t len){
+#if defined(AWC_HAS_LITTLEFS) || defined(AWC_HAS_SPIFFS)
+  if (_file && _fileOpenPath != _cfg.filePath) _fileClose();
+  _rotateIfNeeded(len);
+  if (!_file) {
 #if defined(AWC_HAS_LITTLEFS)
-  _rotateIfNeeded();
-  File f = LittleFS.open(_cfg.filePath, FILE_APPEND, true);
-  if (f) { f.write((const uint8_t*)data, len); f.close(); }
-#elif defined(AWC_HAS_SPIFFS)
-  _rotateIfNeeded();
-  File f = SPIFFS.open(_cfg.filePath, FILE_APPEND);
-  if (!f) { f = SPIFFS.open(_cfg.filePath, FILE_WRITE); }
-  if (f) { f.write((const uint8_t*)data, len); f.close(); }
+    _file = LittleFS.open(_cfg.filePath, FILE_APPEND, true);
+#else
+    _file = SPIFFS.open(_cfg.filePath, FILE_APPEND);
+    if (!_file) { _file = SPIFFS.open(_cfg.filePath, FILE_WRITE); }
+#endif
+    if (!_file) return;
+    _fileOpenPath = _cfg.filePath;
+    _fileSize = _file.size();
+  }
+  _fileSize += _file.write((const uint8_t*)data, len);
+  _file.flush();
 #else
   (void)data; (void)len;
 #endif
 }
 
-String AsyncWebConsole::_formatTimestamp(){
-  uint32_t ms = millis();
-  uint32_t sec = ms / 1000U;
-  uint32_t h = (sec / 3600U) % 100U; // wrap at 99h
-  uint32_t m = (sec / 60U) % 60U;
-  uint32_t s = sec % 60U;
-  uint32_t mm = ms % 1000U;
-  char buf[20];
-  snprintf(buf, sizeof(buf), "[%02u:%02u:%02u.%03u] ", (unsigned)h, (unsigned)m, (unsigned)s, (unsigned)mm);
-  return String(buf);
+void AsyncWebConsole::_fileClose(){
+  if (_file) _file.close();
+  _file = File();
+  _fileOpenPath = nullptr;
+  _fileSize = 0;
+}
+
+bool AsyncWebConsole::_appendToFile(const char* data, size_t len){
+  if (!_cfg.fileLogEnable || !len) return true;
+  bool threaded = _cfg.fileTask && _cfg.fileBufBytes;
+  if (!_fileBuf[0] && _cfg.fileBufBytes) {
+    _fileBufCap = _cfg.fileBufBytes;
+    _fileBuf[0] = static_cast<char*>(malloc(_fileBufCap));
+    _fileBuf[1] = threaded ? static_cast<char*>(malloc(_fileBufCap)) : nullptr;
+    if (!_fileBuf[0] || (threaded && !_fileBuf[1])) {
+      free(_fileBuf[0]); free(_fileBuf[1]);
+      _fileBuf[0] = _fileBuf[1] = nullptr;
+      _fileBufCap = 0;
+      ESP_LOGW(TAG, "File buffer allocation failed, writing unbuffered");
+    }
+  }
+  if (!_fileBuf[0] || (threaded && !_fileBuf[1])) { _fileWrite(data, len); return true; }
+
+  if (_fileFill + len > _fileBufCap) _fileFlush(false);
+  if (_fileFill + len > _fileBufCap) {
+    if (!threaded) { _fileWrite(data, len); return true; } // longer than the buffer
+    if (len <= _fileBufCap) return false; // both buffers busy: the file sink retries
+    _fileDropped += len;
+    _stats.fileDropped.fetch_add(len, std::memory_order_relaxed);
+    return true;
+  }
+  char* buf = _fileBuf[_fileActive];
+  if (!_fileFill) _fileFirstMs = millis();
+  if (_fileDropped) {
+    char note[64];
+    int w = snprintf(note, sizeof(note), "[AsyncWebConsole] file: dropped %u bytes\n", static_cast<unsigned>(_fileDropped));
+    if (w > 0 && _fileFill + static_cast<size_t>(w) + len <= _fileBufCap) {
+      memcpy(buf + _fileFill, note, w);
+      _fileFill += w;
+      _fileDropped = 0;
+    }
+  }
+  memcpy(buf + _fileFill, data, len);
+  _fileFill += len;
+  return true;
+}
+
+// Drain task, once per loop: age-based flush and closing a disabled log
+void AsyncWebConsole::_fileTick(){
+  if (_fileFill && millis() - _fileFirstMs >= _cfg.fileFlushMs) _fileFlush(false);
+  if (!_cfg.fileLogEnable && !_fileFill && !_fileTaskHandle && _file) _fileClose();
+}
+
+void AsyncWebConsole::_fileFlush(bool force){
+  if (!_fileFill) return;
+  if (!_cfg.fileTask || !_fileBuf[1]) {
+    _fileWrite(_fileBuf[_fileActive], _fileFill);
+    _fileFill = 0;
+    if (!_cfg.fileLogEnable) _fileClose();
+    return;
+  }
+  if (!_fileTaskHandle) {
+    _fileTaskStop = false;
+    if (xTaskCreatePinnedToCore(_fileTaskFn, "awc_file", _cfg.fileTaskStack, this,
+                                _cfg.fileTaskPrio, &_fileTaskHandle, tskNO_AFFINITY) != pdPASS) {
+      _fileTaskHandle = nullptr;
+      _fileWrite(_fileBuf[_fileActive], _fileFill);
+      _fileFill = 0;
+      return;
+    }
+  }
+  // Hand the active buffer over once the file task has finished the previous one
+  for (int i = 0; force && _filePending && i < 200; i++) vTaskDelay(pdMS_TO_TICKS(10));
+  if (_filePending) return;
+  _filePendingBuf = _fileActive;
+  _fileActive ^= 1;
+  _filePending = _fileFill;
+  _fileFill = 0;
+  xTaskNotifyGive(_fileTaskHandle);
+}
+
+void AsyncWebConsole::_fileTaskFn(void* arg){
+  auto* self = static_cast<AsyncWebConsole*>(arg);
+  for (;;) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(500));
+    size_t n = self->_filePending;
+    if (n) {
+      self->_fileWrite(self->_fileBuf[self->_filePendingBuf], n);
+      self->_filePending = 0;
+    } else if (!self->_cfg.fileLogEnable) {
+      self->_fileClose();
+    }
+    if (self->_fileTaskStop) break;
+  }
+  self->_fileClose();
+  self->_fileTaskHandle = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// Stops the file task after it wrote any handed-over buffer
+void AsyncWebConsole::_fileStopTask(){
+  if (!_fileTaskHandle) return;
+  _fileTaskStop = true;
+  xTaskNotifyGive(_fileTaskHandle);
+  for (int i = 0; i < 200 && _fileTaskHandle != nullptr; ++i) {
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  if (_fileTaskHandle) {
+    TaskHandle_t t = _fileTaskHandle;
+    _fileTaskHandle = nullptr;
+    vTaskDelete(t);
+  }
+  _filePending = 0;
+  _fileTaskStop = false;
+}
+
+// grep: the backlog is copied out in chunks under _mtx, files are read in
+// chunks; each chunk is searched as a whole (memchr to candidates, then
+// memcmp) and only lines with a hit are cut out. The partial last line is
+// carried to the front of the buffer for the next chunk.
+static constexpr size_t kGrepChunk = 1024;
+static constexpr size_t kGrepLine  = 256; // longer lines keep their last 256 bytes across chunks
+
+struct AsyncWebConsole::GrepJob {
+  AsyncWebConsole* self = nullptr;
+  String   pat;
+  uint32_t client = 0;  // 0: not from a WebSocket, results are printed
+  bool     files = false;
+  uint32_t end = 0;     // backlog position when the command was issued
+  size_t   carry = 0;   // bytes of the partial line at the front of buf
+  size_t   matches = 0;
+  bool     full = false;
+  bool     gone = false; // client left (or shutdown): stop quietly
+  String   out;
+  char     buf[kGrepLine + kGrepChunk];
+};
+
+static const char* _findSub(const char* h, size_t n, const char* p, size_t m) {
+  while (n >= m) {
+    const char* c = static_cast<const char*>(memchr(h, p[0], n - m + 1));
+    if (!c) return nullptr;
+    if (!memcmp(c + 1, p + 1, m - 1)) return c;
+    n -= static_cast<size_t>(c + 1 - h);
+    h = c + 1;
+  }
+  return nullptr;
+}
+
+String AsyncWebConsole::_grepStart(int argc, const String* argv){
+  String pat;
+  bool files = false;
+  for (int i = 1; i < argc; i++) {
+    if (argv[i] == F("--files")) files = true;
+    else if (!pat.length()) pat = argv[i];
+  }
+  if (!pat.length()) return String(F("usage: grep <text> [--files]\n"));
+  if (_grepBusy) return String(F("grep: a search is already running\n"));
+
+  GrepJob* job = new GrepJob();
+  job->self = this;
+  job->pat = pat;
+  job->client = _cmdClient;
+  job->files = files;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  job->end = _wpos;
+  if (_mtx) xSemaphoreGive(_mtx);
+  _grepBusy = true;
+  if (xTaskCreate(_grepTaskFn, "awc_grep", _cfg.grepTaskStack, job, _cfg.grepTaskPrio, nullptr) != pdPASS) {
+    _grepBusy = false;
+    delete job;
+    return String(F("grep: could not start the search task\n"));
+  }
+  return String();
+}
+
+void AsyncWebConsole::_grepTaskFn(void* arg){
+  auto* job = static_cast<GrepJob*>(arg);
+  AsyncWebConsole* self = job->self;
+  self->_grepRun(*job);
+  delete job;
+  self->_grepBusy = false;
+  vTaskDelete(nullptr);
+}
+
+void AsyncWebConsole::_grepRun(GrepJob& job){
+  // Backlog, oldest full line first, up to where it was when grep was typed
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  uint32_t pos = _wpos - static_cast<uint32_t>(_used);
+  if (_used == _bufCap) {
+    uint32_t nl = _backlogFindNl(pos, _wpos);
+    if (nl != _wpos) pos = nl + 1;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  while (static_cast<int32_t>(job.end - pos) > 0 && !job.full && !job.gone && !_grepStop) {
+    if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+    uint32_t oldest = _wpos - static_cast<uint32_t>(_used);
+    if (static_cast<int32_t>(oldest - pos) > 0) { pos = oldest; job.carry = 0; } // overwritten meanwhile
+    size_t n = 0;
+    if (static_cast<int32_t>(job.end - pos) > 0) {
+      n = min(kGrepChunk, static_cast<size_t>(job.end - pos));
+      _backlogCopy(pos, job.buf + job.carry, n);
+    }
+    if (_mtx) xSemaphoreGive(_mtx);
+    pos += static_cast<uint32_t>(n);
+    _grepFeed(job, n, "backlog", !n || pos == job.end);
+    vTaskDelay(1); // leave the CPU to the drain task and idle
+  }
+
+#if defined(AWC_HAS_LITTLEFS) || defined(AWC_HAS_SPIFFS)
+  // Log files, oldest rotation first
+  for (int i = job.files && _cfg.filePath ? _cfg.maxFiles : -1; i >= 0; --i) {
+    if (job.full || job.gone || _grepStop) break;
+    String path = String(_cfg.filePath);
+    if (i) path += "." + String(i);
+#if defined(AWC_HAS_LITTLEFS)
+    if (!LittleFS.exists(path)) continue;
+    File f = LittleFS.open(path, FILE_READ);
+#else
+    if (!SPIFFS.exists(path)) continue;
+    File f = SPIFFS.open(path, FILE_READ);
+#endif
+    if (!f) continue;
+    job.carry = 0;
+    while (!job.full && !job.gone && !_grepStop) {
+      int r = f.read(reinterpret_cast<uint8_t*>(job.buf + job.carry), kGrepChunk);
+      size_t n = r > 0 ? static_cast<size_t>(r) : 0;
+      _grepFeed(job, n, path.c_str(), n == 0);
+      if (!n) break;
+      vTaskDelay(1);
+    }
+    f.close();
+  }
+#endif
+
+  if (job.gone || _grepStop) return;
+  char tail[64];
+  int w = snprintf(tail, sizeof(tail), "grep: %u match%s%s\n", static_cast<unsigned>(job.matches),
+                   job.matches == 1 ? "" : "es", job.full ? " (limit reached)" : "");
+  if (w > 0) job.out += tail;
+  _grepSend(job);
+}
+
+// Searches buf[0, carry + len) and emits every completed line with a hit
+void AsyncWebConsole::_grepFeed(GrepJob& job, size_t len, const char* label, bool last){
+  const char* b = job.buf;
+  const char* p = job.pat.c_str();
+  size_t m = job.pat.length();
+  size_t n = job.carry + len;
+  size_t from = 0;
+  size_t lineFloor = 0; // no line starts before this
+  while (from < n && !job.full && !job.gone) {
+    const char* hit = _findSub(b + from, n - from, p, m);
+    if (!hit) break;
+    size_t h = static_cast<size_t>(hit - b);
+    size_t ls = h;
+    while (ls > lineFloor && b[ls - 1] != '\n') ls--;
+    const char* nl = static_cast<const char*>(memchr(hit, '\n', n - h));
+    if (!nl && !last) break; // rest of the line comes with the next chunk
+    size_t le = nl ? static_cast<size_t>(nl - b) : n;
+    // Hits inside a backlog record header don't count
+    size_t body = (le - ls >= kRecHdrLen && b[ls] == kRecMark) ? ls + kRecHdrLen : ls;
+    if (h < body) { from = body; lineFloor = ls; continue; }
+    _grepEmit(job, label, b + ls, le - ls);
+    from = lineFloor = le + 1;
+  }
+  if (last) { job.carry = 0; return; }
+  size_t tail = 0;
+  while (tail < n && b[n - 1 - tail] != '\n') tail++;
+  if (tail > kGrepLine) tail = kGrepLine;
+  memmove(job.buf, b + n - tail, tail);
+  job.carry = tail;
+}
+
+void AsyncWebConsole::_grepEmit(GrepJob& job, const char* label, const char* line, size_t len){
+  uint32_t ms; uint8_t level;
+  bool rec = len >= kRecHdrLen && _recParse(line, ms, level);
+  const char* body = rec ? line + kRecHdrLen : line;
+  size_t bodyLen = rec ? len - kRecHdrLen : len;
+  if (bodyLen && body[bodyLen - 1] == '\r') bodyLen--;
+  // The echo of a grep command would match itself
+  if (bodyLen >= 7 && !memcmp(body, "> grep ", 7)) return;
+
+  job.out.reserve(job.out.length() + strlen(label) + bodyLen + 24);
+  job.out += label;
+  job.out += F(": ");
+  if (rec && _cfg.timestamps) {
+    char ts[20];
+    size_t tl = _fmtTimestamp(ms, ts, sizeof(ts));
+    ts[tl] = '\0';
+    job.out += ts;
+  }
+  job.out.concat(body, bodyLen);
+  job.out += '\n';
+  if (++job.matches >= _cfg.grepMaxMatches) job.full = true;
+  if (job.out.length() >= kGrepChunk) _grepSend(job);
+}
+
+// Sends the collected matches to the requesting client once it has room
+bool AsyncWebConsole::_grepSend(GrepJob& job){
+  if (!job.out.length()) return true;
+  if (!job.client) {
+    print(job.out);
+    job.out = String();
+    return true;
+  }
+  for (int i = 0; !job.gone; i++) {
+    AsyncWebSocketClient* cli = _grepStop ? nullptr : _sock().client(job.client);
+    if (!cli || i >= 500) { job.gone = true; break; } // gone, or stuck for 5 s
+    if (cli->canSend()) { cli->text(job.out); break; }
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  job.out = String();
+  return !job.gone;
+}
+
+void AsyncWebConsole::_grepStopTask(){
+  if (!_grepBusy) return;
+  _grepStop = true;
+  for (int i = 0; i < 300 && _grepBusy; ++i) vTaskDelay(pdMS_TO_TICKS(10));
+  _grepStop = false;
+}
+
+// awcbench: generator tasks printf() at their share of the rate, paced
+// against micros() and yielding every tick; with --isr a hardware timer adds
+// one share from interrupt context (ring records only, as malloc isn't
+// ISR-safe). The command itself samples the heap until the time is up.
+static constexpr size_t   kBenchMaxLen   = 256;
+static constexpr int      kBenchMaxTasks = 8;
+static constexpr uint32_t kBenchIsrMaxHz = 20000;
+
+struct AsyncWebConsole::BenchGen {
+  AsyncWebConsole* self = nullptr;
+  uint32_t id = 0, rate = 0, len = 0;
+  uint32_t offered = 0;
+  UBaseType_t stackFree = 0;
+  volatile bool stop = false;
+  volatile bool done = false;
+};
+
+static struct {
+  AsyncWebConsole* self;
+  char     line[96];
+  size_t   len;
+  volatile uint32_t fired;
+} s_benchIsr = {};
+
+void IRAM_ATTR AsyncWebConsole::_benchIsr(){
+  AsyncWebConsole* self = s_benchIsr.self;
+  if (!self) return;
+  s_benchIsr.fired++;
+  // Ring only: _allocLine's malloc fallback is neither ISR-safe nor in IRAM
+  char* p = self->_ringReserve(s_benchIsr.len + 1);
+  if (!p) return;
+  memcpy(p, s_benchIsr.line, s_benchIsr.len + 1);
+  self->_enqueueRaw(p);
+}
+
+void AsyncWebConsole::_benchTaskFn(void* arg){
+  auto* g = static_cast<BenchGen*>(arg);
+  char pad[kBenchMaxLen + 1];
+  int prefix = snprintf(nullptr, 0, "awcbench %u %07u ", static_cast<unsigned>(g->id), 0u);
+  size_t padLen = g->len > static_cast<uint32_t>(prefix) + 1 ? g->len - prefix - 1 : 0;
+  memset(pad, 'x', padLen);
+  pad[padLen] = '\0';
+  uint32_t t0 = micros();
+  while (!g->stop) {
+    uint32_t due = static_cast<uint32_t>(static_cast<uint64_t>(micros() - t0) * g->rate / 1000000);
+    while (g->offered < due && !g->stop) {
+      g->self->printf("awcbench %u %07u %s\n", static_cast<unsigned>(g->id), static_cast<unsigned>(g->offered), pad);
+      g->offered++;
+    }
+    vTaskDelay(1);
+  }
+  g->stackFree = uxTaskGetStackHighWaterMark(nullptr);
+  g->done = true;
+  vTaskDelete(nullptr);
+}
+
+void AsyncWebConsole::_benchRun(int argc, const char* const* argv, CmdWriter& out){
+  if (argc < 4) { out.print("usage: awcbench <rate> <seconds> <len> [tasks] [--isr]\n"); return; }
+  uint32_t rate = strtoul(argv[1], nullptr, 10);
+  uint32_t secs = strtoul(argv[2], nullptr, 10);
+  uint32_t len = strtoul(argv[3], nullptr, 10);
+  int tasks = 1;
+  bool isr = false;
+  for (int i = 4; i < argc; i++) {
+    if (!strcmp(argv[i], "--isr")) isr = true;
+    else tasks = atoi(argv[i]);
+  }
+  if (!rate || !secs || secs > 600 || len < 24 || len > kBenchMaxLen || tasks < 1 || tasks > kBenchMaxTasks) {
+    out.printf("awcbench: rate > 0, seconds 1..600, len 24..%u, tasks 1..%d\n", static_cast<unsigned>(kBenchMaxLen), kBenchMaxTasks);
+    return;
+  }
+  // Blocks for the whole run: fine on the command task, not on AsyncTCP
+  if (_cmdClient && !(_cmdTask && xTaskGetCurrentTaskHandle() == _cmdTask)) {
+    out.print("awcbench: needs the command task (Config::cmdQueueLen > 0)\n");
+    return;
+  }
+  uint32_t isrRate = isr ? min(rate / (tasks + 1), kBenchIsrMaxHz) : 0;
+  if (isr && !_ring) { out.print("awcbench: --isr needs Config::ringBytes (malloc is not ISR-safe)\n"); return; }
+#if AWC_HAVE_HEAP_CAPS && defined(MALLOC_CAP_SPIRAM)
+  // PSRAM is unreachable while the flash cache is off, which is when IRAM ISRs run
+  if (isr && (_cfg.bufferCaps & MALLOC_CAP_SPIRAM)) { out.print("awcbench: --isr needs the ring in internal RAM (bufferCaps has MALLOC_CAP_SPIRAM)\n"); return; }
+#endif
+#if !AWC_HAVE_HWTIMER
+  if (isr) { out.print("awcbench: --isr needs the Arduino timer API\n"); return; }
+#endif
+  if (isr && !isrRate) { out.print("awcbench: rate too low for --isr\n"); return; }
+  if (_benchBusy) { out.print("awcbench: already running\n"); return; }
+  _benchBusy = true;
+
+  Stats s0 = stats();
+  uint32_t busy0 = _drainBusyUs.load(std::memory_order_relaxed);
+  // High-water marks are for this run only
+  _stats.queueHigh.store(0, std::memory_order_relaxed);
+  _stats.latencyMaxUs.store(0, std::memory_order_relaxed);
+  uint32_t heapMin = ESP.getFreeHeap();
+
+  BenchGen* gens = new BenchGen[tasks];
+  uint32_t taskRate = (rate - isrRate) / tasks;
+  int started = 0;
+  for (int i = 0; i < tasks; i++) {
+    gens[i].self = this;
+    gens[i].id = i;
+    gens[i].len = len;
+    gens[i].rate = taskRate + (i == 0 ? (rate - isrRate) % tasks : 0);
+    if (xTaskCreate(_benchTaskFn, "awc_bench", 3072, &gens[i], uxTaskPriorityGet(nullptr), nullptr) != pdPASS) break;
+    started++;
+  }
+
+#if AWC_HAVE_HWTIMER
+  hw_timer_t* timer = nullptr;
+  if (isr) {
+    int n = snprintf(s_benchIsr.line, sizeof(s_benchIsr.line), "awcbench isr ");
+    size_t want = min<size_t>(len, sizeof(s_benchIsr.line) - 1);
+    while (static_cast<size_t>(n) + 1 < want) s_benchIsr.line[n++] = 'x';
+    s_benchIsr.line[n++] = '\n';
+    s_benchIsr.line[n] = '\0';
+    s_benchIsr.len = n;
+    s_benchIsr.fired = 0;
+    s_benchIsr.self = this;
+#if defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+    timer = timerBegin(1000000);
+    if (timer) {
+      timerAttachInterrupt(timer, &_benchIsr);
+      timerAlarm(timer, 1000000 / isrRate, true, 0);
+    }
+#else
+    timer = timerBegin(0, 80, true); // 1 MHz
+    if (timer) {
+      timerAttachInterrupt(timer, &_benchIsr, true);
+      timerAlarmWrite(timer, 1000000 / isrRate, true);
+      timerAlarmEnable(timer);
+    }
+#endif
+    if (!timer) {
+      s_benchIsr.self = nullptr;
+      isrRate = 0;
+    }
+  }
+#endif
+
+  out.printf("awcbench: %d task%s%s, %u lines/s, %u bytes, %u s\n", started, started == 1 ? "" : "s",
+             isrRate ? " + timer ISR" : "", static_cast<unsigned>(rate), static_cast<unsigned>(len), static_cast<unsigned>(secs));
+  out.send();
+  uint32_t t0 = millis();
+  while (millis() - t0 < secs * 1000) {
+    uint32_t f = ESP.getFreeHeap();
+    if (f < heapMin) heapMin = f;
+    vTaskDelay(pdMS_TO_TICKS(10));
+  }
+
+#if AWC_HAVE_HWTIMER
+  if (timer) timerEnd(timer);
+  s_benchIsr.self = nullptr;
+#endif
+  for (int i = 0; i < started; i++) gens[i].stop = true;
+  bool allDone = false;
+  for (int t = 0; t < 500 && !allDone; t++) {
+    allDone = true;
+    for (int i = 0; i < started; i++) allDone = allDone && gens[i].done;
+    if (!allDone) vTaskDelay(pdMS_TO_TICKS(10));
+  }
+  float elapsed = (millis() - t0) / 1000.0f;
+  // Let the drain task publish what is still queued before reading counters
+  for (int t = 0; t < 200 && _q && uxQueueMessagesWaiting(_q); t++) vTaskDelay(pdMS_TO_TICKS(10));
+  vTaskDelay(pdMS_TO_TICKS(50));
+
+  Stats s1 = stats();
+  uint32_t busyMs = (_drainBusyUs.load(std::memory_order_relaxed) - busy0) / 1000;
+  uint32_t offered = s_benchIsr.fired;
+  UBaseType_t genStack = ~static_cast<UBaseType_t>(0);
+  for (int i = 0; i < started; i++) {
+    offered += gens[i].offered;
+    if (gens[i].done && gens[i].stackFree < genStack) genStack = gens[i].stackFree;
+  }
+  if (allDone) delete[] gens; // else a generator is still running: leak rather than free under it
+  uint32_t queued = s1.enqueued - s0.enqueued;
+  uint32_t lines = s1.lines - s0.lines;
+  uint32_t bytes = s1.bytes - s0.bytes;
+
+  out.printf("offered   %u lines (%.0f/s)\n", static_cast<unsigned>(offered), offered / elapsed);
+  out.printf("queued    %u lines (%.0f/s), dropped: queue full %u, no memory %u\n", static_cast<unsigned>(queued), queued / elapsed,
+             static_cast<unsigned>(s1.droppedQueue - s0.droppedQueue), static_cast<unsigned>(s1.droppedNoMem - s0.droppedNoMem));
+  out.printf("published %u lines, %u bytes (%.0f B/s)\n", static_cast<unsigned>(lines), static_cast<unsigned>(bytes), bytes / elapsed);
+  out.printf("drain     busy %u ms (%.1f%% of the run), stack free %u B, queue high %u of %u\n",
+             static_cast<unsigned>(busyMs), busyMs / (elapsed * 10.0f),
+             static_cast<unsigned>(_task ? uxTaskGetStackHighWaterMark(_task) : 0),
+             static_cast<unsigned>(s1.queueHigh), static_cast<unsigned>(_cfg.queueLen));
+  out.printf("latency   max %u us (enqueue to clients/sinks)\n", static_cast<unsigned>(s1.latencyMaxUs));
+  out.printf("skipped   %u bytes by slow clients, %u by sinks\n",
+             static_cast<unsigned>(s1.wsSkipped - s0.wsSkipped), static_cast<unsigned>(s1.sinkSkipped - s0.sinkSkipped));
+  out.printf("heap      free min %u B during the run (%u B since boot)\n",
+             static_cast<unsigned>(heapMin), static_cast<unsigned>(ESP.getMinFreeHeap()));
+  if (started) out.printf("producers stack free %u B\n", static_cast<unsigned>(genStack));
+  _benchBusy = false;
+}
+
+// Remote syslog: each line becomes an RFC 5424 message
+// "<PRI>1 - HOSTNAME APP-NAME - - - MSG". TIMESTAMP is the NILVALUE (no wall
+// clock is assumed, the collector stamps arrival); the rendered uptime prefix
+// stays in MSG. With udpBatch, messages are LF-separated within a datagram.
+size_t AsyncWebConsole::_udpWrite(const char* data, size_t len){
+  if (!_udpBuf) {
+    size_t cap = max(_cfg.udpMaxDatagram, static_cast<size_t>(128));
+    _udpBuf = static_cast<char*>(_capsMalloc(cap, _cfg.bufferCaps));
+    if (!_udpBuf) return len; // best effort, like the datagrams themselves
+    _udpCap = cap;
+  }
+  const char* end = data + len;
+  while (data < end) {
+    const char* nl = static_cast<const char*>(memchr(data, '\n', end - data));
+    const char* le = nl ? nl : end;
+    _udpAppendLine(data, le - data);
+    data = nl ? nl + 1 : end;
+  }
+  return len;
+}
+
+void AsyncWebConsole::_udpAppendLine(const char* line, size_t n){
+  static const uint8_t kSeverity[] = { 6, 3, 4, 6, 7, 7 }; // by ESP_LOG_* level
+  if (n && line[n - 1] == '\r') n--;
+  size_t ts = 0;
+  if (_cfg.timestamps && n >= 15 && line[0] == '[' && line[13] == ']' && line[14] == ' ') ts = 15;
+
+  // Severity from the IDF prefix; its color escape is dropped from MSG
+  char probe[16];
+  size_t pn = min(n - ts, sizeof(probe) - 1);
+  memcpy(probe, line + ts, pn);
+  probe[pn] = '\0';
+  esp_log_level_t level = _detectEspLogLevel(probe);
+  const char* msg = line + ts;
+  size_t mlen = n - ts;
+  if (mlen > 2 && msg[0] == '\x1b' && msg[1] == '[') {
+    for (size_t i = 2; i < mlen && i < 12; i++) {
+      if (msg[i] == 'm') { msg += i + 1; mlen -= i + 1; break; }
+    }
+  }
+  if (mlen >= 4 && memcmp(msg + mlen - 4, "\x1b[0m", 4) == 0) mlen -= 4;
+
+  const char* host = _cfg.udpHostname;
+#if AWC_HAVE_WIFI
+  if (!host || !*host) host = WiFi.getHostname();
+#endif
+  if (!host || !*host) host = "-";
+  const char* app = (_cfg.udpAppName && *_cfg.udpAppName) ? _cfg.udpAppName : "-";
+  unsigned pri = (_cfg.udpFacility & 0x1F) * 8U + kSeverity[level < sizeof(kSeverity) ? level : 0];
+  char hdr[96];
+  int w = snprintf(hdr, sizeof(hdr), "<%u>1 - %s %s - - - ", pri, host, app);
+  if (w <= 0) return;
+  size_t hl = min(static_cast<size_t>(w), sizeof(hdr) - 1);
+  size_t sep = _cfg.udpBatch ? 1 : 0;
+  if (hl + sep >= _udpCap) return;
+
+  // Clip messages longer than a datagram
+  size_t avail = _udpCap - hl - sep;
+  if (ts > avail) ts = avail;
+  if (ts + mlen > avail) mlen = avail - ts;
+  size_t total = hl + ts + mlen + sep;
+  if (_udpLen + total > _udpCap) _udpFlush();
+  if (!_udpLen) _udpFirstMs = millis();
+  memcpy(_udpBuf + _udpLen, hdr, hl);
+  memcpy(_udpBuf + _udpLen + hl, line, ts);
+  memcpy(_udpBuf + _udpLen + hl + ts, msg, mlen);
+  _udpLen += total;
+  if (sep) _udpBuf[_udpLen - 1] = '\n';
+  else _udpFlush();
+}
+
+void AsyncWebConsole::_udpFlush(){
+  if (!_udpLen) return;
+#if AWC_HAVE_ASYNCUDP
+  if (_udpResolve()) {
+    if (!_udp) _udp = new AsyncUDP();
+    if (!_udp->writeTo(reinterpret_cast<const uint8_t*>(_udpBuf), _udpLen, IPAddress(_udpAddr), _cfg.udpPort))
+      _stats.udpDropped.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    _stats.udpDropped.fetch_add(1, std::memory_order_relaxed);
+  }
+#endif
+  _udpLen = 0;
+}
+
+// Drain task, once per loop: age-based flush (udpFlushMs, else wsFlushIntervalMs)
+void AsyncWebConsole::_udpTick(){
+  uint32_t flushMs = _cfg.udpFlushMs ? _cfg.udpFlushMs : _cfg.wsFlushIntervalMs;
+  if (_udpLen && millis() - _udpFirstMs >= flushMs) _udpFlush();
+}
+
+bool AsyncWebConsole::_udpResolve(){
+  if (_udpAddr) return true;
+#if AWC_HAVE_ASYNCUDP
+  if (!_cfg.udpHost || !*_cfg.udpHost) return false;
+  // hostByName() blocks the drain task, so failed lookups wait 10 s
+  if (_udpResolveMs && millis() - _udpResolveMs < 10000) return false;
+  IPAddress ip;
+  bool ok = ip.fromString(_cfg.udpHost);
+#if AWC_HAVE_WIFI
+  if (!ok && WiFi.isConnected()) ok = WiFi.hostByName(_cfg.udpHost, ip) == 1;
+#endif
+  if (ok) _udpAddr = static_cast<uint32_t>(ip);
+  if (!_udpAddr) _udpResolveMs = millis() | 1;
+#endif
+  return _udpAddr != 0;
+}
+
+void AsyncWebConsole::_udpReset(){
+#if AWC_HAVE_ASYNCUDP
+  delete _udp;
+#endif
+  _udp = nullptr;
+  free(_udpBuf);
+  _udpBuf = nullptr;
+  _udpCap = _udpLen = 0;
+  _udpAddr = 0;
+  _udpResolveMs = 0;
 }
 
-esp_log_level_t AsyncWebConsole::_detectEspLogLevel(const String& s){
+esp_log_level_t AsyncWebConsole::_detectEspLogLevel(const char* s){
   // Detect IDF log format: optional ANSI escape + "X (" where X is E/W/I/D/V
+  if (!s) return ESP_LOG_NONE;
   size_t offset = 0;
   // Skip optional ANSI escape prefix: \x1b[...m
-  if (s.length() > 2 && s[0] == '\x1b' && s[1] == '[') {
-    int mPos = s.indexOf('m');
-    if (mPos > 0 && mPos < 12) offset = mPos + 1;
+  if (s[0] == '\x1b' && s[1] == '[') {
+    for (size_t i = 2; i < 12 && s[i]; i++) {
+      if (s[i] == 'm') { offset = i + 1; break; }
+    }
   }
   // Need at least "X (" at offset
-  if (offset + 2 >= s.length()) return ESP_LOG_NONE;
+  for (size_t i = 0; i < 3; i++) if (!s[offset + i]) return ESP_LOG_NONE;
   if (s[offset + 1] != ' ' || s[offset + 2] != '(') return ESP_LOG_NONE;
 
   switch (s[offset]) {
@@ -788,16 +3384,217 @@ esp_log_level_t AsyncWebConsole::_detectEspLogLevel(const String& s){
   }
 }
 
-bool AsyncWebConsole::_allowSyslog(const char * s) const{
-  esp_log_level_t lvl = _detectEspLogLevel(s);
+bool AsyncWebConsole::_allowLevel(const char * s, esp_log_level_t lvl) const{
   if (lvl == ESP_LOG_NONE) return true; // unknown/none -> pass
-  return lvl <= _cfg.syslogMaxLevel;
+  if (lvl > AWC_MIN_LEVEL || lvl > _cfg.syslogMaxLevel) return false;
+  return !_tagFilterCount || lvl <= _tagLimit(s);
+}
+
+// Token bucket per format pointer: direct-mapped, a colliding call site
+// takes the slot over with a full bucket. Short critical section, ISR-safe.
+bool AsyncWebConsole::_rateAdmit(const char* fmt, uint32_t& dropped){
+  uint32_t now = millis();
+  uint32_t cap = static_cast<uint32_t>(_cfg.rateLimitBurst ? _cfg.rateLimitBurst : 1) * 1000U;
+  uint32_t rate = _cfg.rateLimitPerSec;
+  size_t i = ((static_cast<uint32_t>(reinterpret_cast<uintptr_t>(fmt)) >> 2) * 2654435761U) >> 27; // 32 slots
+  bool ok;
+  portENTER_CRITICAL_SAFE(&_rateMux);
+  RateSlot& r = _rate[i % kRateSlots];
+  if (r.fmt != fmt) {
+    r = RateSlot{fmt, now, cap, 0};
+  } else {
+    uint32_t elapsed = now - r.ms;
+    r.ms = now;
+    r.tokens = elapsed >= cap / rate ? cap : min(cap, r.tokens + elapsed * rate);
+  }
+  ok = r.tokens >= 1000U;
+  if (ok) { r.tokens -= 1000U; dropped = r.dropped; r.dropped = 0; }
+  else r.dropped++;
+  portEXIT_CRITICAL_SAFE(&_rateMux);
+  return ok;
+}
+
+uint32_t AsyncWebConsole::_tagHash(const char* tag, size_t n){
+  uint32_t h = 2166136261U; // FNV-1a
+  for (size_t i = 0; i < n; i++) { h ^= static_cast<uint8_t>(tag[i]); h *= 16777619U; }
+  return h & ~0xFFU;
+}
+
+// Tag of a formatted IDF line; format strings ("W (%lu) %s: ") have none
+const char* AsyncWebConsole::_lineTag(const char* s, size_t& n){
+  size_t i = 0;
+  if (s[0] == '\x1b' && s[1] == '[') {
+    for (size_t k = 2; k < 12 && s[k]; k++) {
+      if (s[k] == 'm') { i = k + 1; break; }
+    }
+  }
+  if (!s[i] || s[i + 1] != ' ' || s[i + 2] != '(') return nullptr;
+  // Timestamp: ticks, or HH:MM:SS.mmm with the system time source
+  for (i += 3; s[i] && s[i] != ')' && i < 40; i++) {}
+  if (s[i] != ')' || s[i + 1] != ' ' || s[i + 2] == '%') return nullptr;
+  const char* tag = s + i + 2;
+  for (n = 0; n < 32 && tag[n] && tag[n] != '\n'; n++) {
+    if (tag[n] == ':') return n ? tag : nullptr;
+  }
+  return nullptr;
+}
+
+esp_log_level_t AsyncWebConsole::_tagLimit(const char* s) const{
+  size_t n;
+  const char* tag = _lineTag(s, n);
+  if (!tag) return ESP_LOG_VERBOSE;
+  uint32_t key = _tagHash(tag, n);
+  size_t i = (key >> 8) & (_maxTagFilters - 1);
+  for (size_t k = 0; k < _maxTagFilters; k++, i = (i + 1) & (_maxTagFilters - 1)) {
+    uint32_t e = _tagFilters[i];
+    if (!e) break;
+    if ((e & ~0xFFU) == key) return static_cast<esp_log_level_t>((e & 0xFF) - 1);
+  }
+  return ESP_LOG_VERBOSE;
+}
+
+bool AsyncWebConsole::setConsoleTagLevel(const char* tag, esp_log_level_t level){
+  if (!tag || !*tag) return false;
+  uint32_t key = _tagHash(tag, strlen(tag));
+  uint32_t entry = key | (static_cast<uint32_t>(level) + 1);
+  bool ok = false;
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  size_t i = (key >> 8) & (_maxTagFilters - 1);
+  for (size_t k = 0; k < _maxTagFilters; k++, i = (i + 1) & (_maxTagFilters - 1)) {
+    uint32_t e = _tagFilters[i];
+    if (e && (e & ~0xFFU) != key) continue;
+    _tagFilters[i] = entry;
+    if (!e) _tagFilterCount++;
+    ok = true;
+    break;
+  }
+  if (_mtx) xSemaphoreGive(_mtx);
+  return ok;
+}
+
+void AsyncWebConsole::clearConsoleTagLevels(){
+  if (_mtx) xSemaphoreTake(_mtx, portMAX_DELAY);
+  _tagFilterCount = 0;
+  for (size_t i = 0; i < _maxTagFilters; i++) _tagFilters[i] = 0;
+  if (_mtx) xSemaphoreGive(_mtx);
+}
+
+// Pipeline stats
+void AsyncWebConsole::_statLatency(uint32_t us){
+  size_t b = 0;
+  while (b < kLatencyBuckets - 1 && us >= kLatencyBoundsUs[b]) b++;
+  _stats.latency[b].fetch_add(1, std::memory_order_relaxed);
+  if (us > _stats.latencyMaxUs.load(std::memory_order_relaxed)) _stats.latencyMaxUs.store(us, std::memory_order_relaxed);
+}
+
+AsyncWebConsole::Stats AsyncWebConsole::stats() const{
+  Stats st{};
+  st.enqueued       = _stats.enqueued.load(std::memory_order_relaxed);
+  st.droppedQueue   = _stats.droppedQueue.load(std::memory_order_relaxed);
+  st.droppedNoMem   = _stats.droppedNoMem.load(std::memory_order_relaxed);
+  st.filtered       = _stats.filtered.load(std::memory_order_relaxed);
+  st.rateLimited    = _stats.rateLimited.load(std::memory_order_relaxed);
+  st.repeated       = _stats.repeated.load(std::memory_order_relaxed);
+  st.lines          = _stats.lines.load(std::memory_order_relaxed);
+  st.bytes          = _stats.bytes.load(std::memory_order_relaxed);
+  st.backlogEvicted = _stats.backlogEvicted.load(std::memory_order_relaxed);
+  st.wsSkipped      = _stats.wsSkipped.load(std::memory_order_relaxed);
+  st.sinkSkipped    = _stats.sinkSkipped.load(std::memory_order_relaxed);
+  st.fileDropped    = _stats.fileDropped.load(std::memory_order_relaxed);
+  st.udpDropped     = _stats.udpDropped.load(std::memory_order_relaxed);
+  st.queueDepth     = _q ? static_cast<uint32_t>(uxQueueMessagesWaiting(_q)) : 0;
+  st.queueHigh      = _stats.queueHigh.load(std::memory_order_relaxed);
+  st.latencyMaxUs   = _stats.latencyMaxUs.load(std::memory_order_relaxed);
+  for (size_t i = 0; i < kLatencyBuckets; i++) st.latency[i] = _stats.latency[i].load(std::memory_order_relaxed);
+  return st;
+}
+
+void AsyncWebConsole::resetStats(){
+  for (auto* c : { &_stats.enqueued, &_stats.droppedQueue, &_stats.droppedNoMem, &_stats.filtered,
+                   &_stats.rateLimited, &_stats.repeated,
+                   &_stats.lines, &_stats.bytes, &_stats.backlogEvicted, &_stats.wsSkipped,
+                   &_stats.sinkSkipped, &_stats.fileDropped, &_stats.udpDropped, &_stats.queueHigh,
+                   &_stats.latencyMaxUs }) {
+    c->store(0, std::memory_order_relaxed);
+  }
+  for (auto& c : _stats.latency) c.store(0, std::memory_order_relaxed);
+}
+
+String AsyncWebConsole::statsJson() const{
+  Stats st = stats();
+  char buf[576];
+  int n = snprintf(buf, sizeof(buf),
+    "{\"enqueued\":%u,\"droppedQueue\":%u,\"droppedNoMem\":%u,\"filtered\":%u,"
+    "\"rateLimited\":%u,\"repeated\":%u,"
+    "\"lines\":%u,\"bytes\":%u,\"backlogEvicted\":%u,\"wsSkipped\":%u,\"sinkSkipped\":%u,"
+    "\"fileDropped\":%u,\"udpDropped\":%u,\"queueDepth\":%u,\"queueHigh\":%u,"
+    "\"latencyMaxUs\":%u,\"latencyBoundsUs\":[",
+    (unsigned)st.enqueued, (unsigned)st.droppedQueue, (unsigned)st.droppedNoMem, (unsigned)st.filtered,
+    (unsigned)st.rateLimited, (unsigned)st.repeated,
+    (unsigned)st.lines, (unsigned)st.bytes, (unsigned)st.backlogEvicted, (unsigned)st.wsSkipped,
+    (unsigned)st.sinkSkipped, (unsigned)st.fileDropped, (unsigned)st.udpDropped,
+    (unsigned)st.queueDepth, (unsigned)st.queueHigh, (unsigned)st.latencyMaxUs);
+  size_t len = n > 0 ? min(static_cast<size_t>(n), sizeof(buf) - 1) : 0;
+  for (size_t i = 0; i < kLatencyBuckets - 1 && len < sizeof(buf); i++) {
+    n = snprintf(buf + len, sizeof(buf) - len, "%s%u", i ? "," : "", (unsigned)kLatencyBoundsUs[i]);
+    if (n > 0) len = min(len + n, sizeof(buf) - 1);
+  }
+  for (size_t i = 0; i < kLatencyBuckets && len < sizeof(buf); i++) {
+    n = snprintf(buf + len, sizeof(buf) - len, "%s%u", i ? "," : "],\"latency\":[", (unsigned)st.latency[i]);
+    if (n > 0) len = min(len + n, sizeof(buf) - 1);
+  }
+  if (len < sizeof(buf)) {
+    n = snprintf(buf + len, sizeof(buf) - len, "]}");
+    if (n > 0) len = min(len + n, sizeof(buf) - 1);
+  }
+  return String(buf);
 }
 
 bool AsyncWebConsole::addCommand(const char* name, const char* args, const char* help, CmdArgHandler fn){
-  if (!name || !*name || !fn) return false;
-  if (_cmdCount >= _maxCmds) return false;
-  _cmds[_cmdCount++] = CommandEntry{name, args?args:"", help?help:"", std::move(fn)};
+  if (!fn) return false;
+  return _addCmd(CommandEntry{name, args?args:"", help?help:"", std::move(fn), CmdStreamHandler(), CmdArgvHandler()});
+}
+
+bool AsyncWebConsole::addCommand(const char* name, const char* args, const char* help, CmdStreamHandler fn){
+  if (!fn) return false;
+  return _addCmd(CommandEntry{name, args?args:"", help?help:"", CmdArgHandler(), std::move(fn), CmdArgvHandler()});
+}
+
+bool AsyncWebConsole::addCommand(const char* name, const char* args, const char* help, CmdArgvHandler fn){
+  if (!fn) return false;
+  return _addCmd(CommandEntry{name, args?args:"", help?help:"", CmdArgHandler(), CmdStreamHandler(), std::move(fn)});
+}
+
+size_t AsyncWebConsole::_cmdLowerBound(const char* name) const {
+  size_t lo = 0, hi = _cmdCount;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (strcasecmp(_cmds[mid].name, name) < 0) lo = mid + 1;
+    else hi = mid;
+  }
+  return lo;
+}
+
+// Keeps the table sorted; registering a name again replaces its handler
+bool AsyncWebConsole::_addCmd(CommandEntry&& e){
+  if (!e.name || !*e.name) return false;
+  size_t at = _cmdLowerBound(e.name);
+  if (at < _cmdCount && !strcasecmp(_cmds[at].name, e.name)) {
+    _cmds[at] = std::move(e);
+    return true;
+  }
+  if (_cmdCount == _cmdCap) {
+    size_t cap = _cmdCap ? _cmdCap * 2 : 16;
+    CommandEntry* grown = new (std::nothrow) CommandEntry[cap];
+    if (!grown) return false;
+    for (size_t i = 0; i < _cmdCount; i++) grown[i] = std::move(_cmds[i]);
+    delete[] _cmds;
+    _cmds = grown;
+    _cmdCap = cap;
+  }
+  for (size_t i = _cmdCount; i > at; --i) _cmds[i] = std::move(_cmds[i - 1]);
+  _cmds[at] = std::move(e);
+  _cmdCount++;
   return true;
 }
 
@@ -836,38 +3633,172 @@ String AsyncWebConsole::helpText() const {
 }
 
 String AsyncWebConsole::dispatch(const String& raw){
-  String c = raw; c.trim(); if (!c.length()) return String();
-  String argv[_maxArgs];
-  int argc = _tokenize(c, argv, _maxArgs);
+  // One copy of the line, on the stack unless it is very long; the tokens
+  // are cut from it in place
+  size_t n = raw.length();
+  char stackLine[_cmdLineMax];
+  char* line = n < sizeof(stackLine) ? stackLine : static_cast<char*>(malloc(n + 1));
+  if (!line) return String();
+  memcpy(line, raw.c_str(), n);
+  line[n] = '\0';
+  String out = _dispatchLine(line);
+  if (line != stackLine) free(line);
+  return out;
+}
+
+String AsyncWebConsole::_dispatchLine(char* line){
+  char* argv[_maxArgs];
+  int argc = _tokenize(line, argv, _maxArgs);
   if (argc <= 0) return String();
-  if (argv[0] == F("help")) return helpText();
-  for (size_t i=0;i<_cmdCount;i++){
-    if (argv[0].equalsIgnoreCase(_cmds[i].name)){
-      auto& fn = _cmds[i].fn; if (fn) return fn(argc, argv);
-      break;
+  if (!strcmp(argv[0], "help")) return helpText();
+  size_t at = _cmdLowerBound(argv[0]);
+  if (at >= _cmdCount || strcasecmp(_cmds[at].name, argv[0])) return String(F("Unknown command. Type 'help'\n"));
+  const CommandEntry& e = _cmds[at];
+  // Only the command task may wait for the client's queue to drain
+  bool wait = _cmdTask && xTaskGetCurrentTaskHandle() == _cmdTask;
+  if (e.fn || e.sfn) {
+    // String handlers get String argv; short ones fit String's inline buffer
+    String sargv[_maxArgs];
+    for (int i = 0; i < argc; i++) sargv[i] = argv[i];
+    if (e.fn) return e.fn(argc, sargv);
+    CmdWriter out(*this, _cmdClient, wait);
+    e.sfn(argc, sargv, out);
+    out.send();
+    return String();
+  }
+  CmdWriter out(*this, _cmdClient, wait);
+  e.vfn(argc, argv, out);
+  out.send();
+  return String();
+}
+
+void AsyncWebConsole::_cmdRun(uint32_t client, const String& cmd){
+  printf("> %s", cmd.c_str());
+  _cmdClient = client;
+  String out = dispatch(cmd);
+  _cmdClient = 0;
+  if (out.length()) print(out);
+}
+
+// Called on the AsyncTCP task only, so the lazy setup needs no lock
+bool AsyncWebConsole::_cmdPost(uint32_t client, const uint8_t* data, size_t len){
+  if (!_cmdQ && !(_cmdQ = xQueueCreate(_cfg.cmdQueueLen, sizeof(CmdJob)))) return false;
+  if (!_cmdTask && xTaskCreate(_cmdTaskFn, "awc_cmd", _cfg.cmdTaskStack, this,
+                               _cfg.cmdTaskPrio, &_cmdTask) != pdPASS) {
+    _cmdTask = nullptr;
+    return false;
+  }
+  // The queue copies the job, so it is built on the stack
+  CmdJob job;
+  job.client = client;
+  memcpy(job.line, data, len);
+  job.line[len] = '\0';
+  return xQueueSend(_cmdQ, &job, 0) == pdTRUE;
+}
+
+void AsyncWebConsole::_cmdTaskFn(void* arg){
+  auto* self = static_cast<AsyncWebConsole*>(arg);
+  CmdJob job;
+  String cmd; // keeps its buffer from one command to the next
+  while (xQueueReceive(self->_cmdQ, &job, portMAX_DELAY) == pdTRUE) {
+    if (!job.client) break; // shutdown sentinel
+    cmd = job.line;
+    self->_cmdRun(job.client, cmd);
+  }
+  self->_cmdTask = nullptr;
+  vTaskDelete(nullptr);
+}
+
+void AsyncWebConsole::_cmdStopTask(){
+  if (_cmdTask) {
+    CmdJob sentinel;
+    sentinel.client = 0;
+    sentinel.line[0] = '\0';
+    xQueueSend(_cmdQ, &sentinel, pdMS_TO_TICKS(50));
+    // A handler that is still running gets up to 2 seconds
+    for (int i = 0; i < 200 && _cmdTask != nullptr; ++i) vTaskDelay(pdMS_TO_TICKS(10));
+    if (_cmdTask) {
+      TaskHandle_t t = _cmdTask;
+      _cmdTask = nullptr;
+      vTaskDelete(t);
     }
   }
-  return String(F("Unknown command. Type 'help'\n"));
+  if (_cmdQ) {
+    vQueueDelete(_cmdQ);
+    _cmdQ = nullptr;
+  }
 }
 
-// no explicit dispatcher toggle; subclass and override dispatch() if needed
+// Length of p[0..n) without a UTF-8 sequence cut off at the end, so a text
+// frame never ends inside a character (browsers drop the socket on those)
+static size_t _utf8Whole(const char* p, size_t n){
+  size_t i = n;
+  while (i && n - i < 3 && (static_cast<uint8_t>(p[i - 1]) & 0xC0) == 0x80) i--;
+  if (!i) return n;
+  uint8_t lead = static_cast<uint8_t>(p[i - 1]);
+  size_t need = lead >= 0xF0 ? 4 : lead >= 0xE0 ? 3 : lead >= 0xC0 ? 2 : 1;
+  return (n - (i - 1) < need && i > 1) ? i - 1 : n;
+}
 
-int AsyncWebConsole::_tokenize(const String& in, String out[], int maxOut){
-  int n = 0; bool inQuote = false; String cur;
-  for (size_t i=0;i<in.length();i++){
-    char ch = in[i];
-    if (ch == '"') { inQuote = !inQuote; continue; }
-    if (!inQuote && (ch==' ' || ch=='\t')){
-      if (cur.length()){
-        if (n < maxOut) out[n++] = cur;
-        cur = String();
-      }
-      continue;
+size_t AsyncWebConsole::CmdWriter::write(const uint8_t* buf, size_t len){
+  for (size_t done = 0; done < len; ) {
+    size_t n = min(len - done, kChunk - _len);
+    memcpy(_buf + _len, buf + done, n);
+    _len += n;
+    done += n;
+    if (_len < kChunk) break;
+    // Whole lines, so log frames to the same client don't split one
+    size_t cut = _len;
+    while (cut && _buf[cut - 1] != '\n') cut--;
+    _sendPart(cut ? cut : _utf8Whole(_buf, _len));
+  }
+  return len;
+}
+
+void AsyncWebConsole::CmdWriter::send(){
+  if (_len) _sendPart(_len);
+}
+
+bool AsyncWebConsole::CmdWriter::_sendPart(size_t n){
+  if (!_gone && !_client) {
+    String s;
+    s.concat(_buf, n);
+    _owner.print(s);
+  } else if (!_gone) {
+    for (int i = 0; ; i++) {
+      AsyncWebSocketClient* cli = _owner._sock().client(_client);
+      if (!cli || i >= 500) { _gone = true; break; } // gone, or stuck for 5 s
+      if (!_wait || cli->canSend()) { cli->text(_buf, n); break; }
+      vTaskDelay(pdMS_TO_TICKS(10));
     }
-    cur += ch;
   }
-  if (cur.length()){
-    if (n < maxOut) out[n++] = cur;
+  if (_gone) n = _len; // nobody to send to: drop the rest
+  memmove(_buf, _buf + n, _len - n);
+  _len -= n;
+  return !_gone;
+}
+
+// no explicit dispatcher toggle; subclass and override dispatch() if needed
+
+// Splits in place: tokens are NUL-terminated where they lie, quotes are
+// squeezed out (a quoted part may contain blanks), empty tokens are skipped
+int AsyncWebConsole::_tokenize(char* line, char* argv[], int maxArgs){
+  int n = 0;
+  char* r = line;
+  char* w = line; // never passes r
+  while (*r) {
+    char* tok = w;
+    bool inQuote = false;
+    for (; *r; r++) {
+      char ch = *r;
+      if (ch == '"') { inQuote = !inQuote; continue; }
+      if (!inQuote && (ch == ' ' || ch == '\t' || ch == '\r' || ch == '\n')) break;
+      *w++ = ch;
+    }
+    if (*r) r++;
+    if (w == tok) continue;
+    *w++ = '\0';
+    if (n < maxArgs) argv[n++] = tok;
   }
   return n;
 }
@@ -2,29 +2,120 @@
 #include <Arduino.h>
 #include <AsyncTCP.h>
 #include <ESPAsyncWebServer.h>
+#include <FS.h>
+#include <atomic>
 #include <functional>
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/queue.h"
 #include "freertos/task.h"
 
+class AsyncUDP;
+
+// Console-side compile-time level cap: esp_log lines more verbose than this
+// never reach the console, backlog or sinks (UART passthrough is unaffected).
+// E.g. -DAWC_MIN_LEVEL=ESP_LOG_INFO
+#ifndef AWC_MIN_LEVEL
+#define AWC_MIN_LEVEL ESP_LOG_VERBOSE
+#endif
+
+// Crash log: the last AWC_CRASHLOG_BYTES of console output are mirrored into
+// RAM that survives a panic, watchdog or software reset (not a power cycle)
+// and shown as the previous boot's log after the restart. 0 compiles it out.
+// Kept in RTC slow memory (8 KB on the ESP32) unless AWC_CRASHLOG_ATTR says
+// otherwise, e.g. -DAWC_CRASHLOG_ATTR=__NOINIT_ATTR for no-init DRAM.
+#ifndef AWC_CRASHLOG_BYTES
+#define AWC_CRASHLOG_BYTES 0
+#endif
+
 class AsyncWebConsole {
 public:
   using CmdArgHandler = std::function<String(int, const String*)>;
 
+  // Output of a streaming command. Everything written goes to the client that
+  // issued the command only (to print() when there is none), in whole-line
+  // frames of up to kChunk bytes, sent as the client's queue has room.
+  class CmdWriter : public Print {
+  public:
+    static constexpr size_t kChunk = 512;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t len) override;
+    using Print::write;
+    void send();                            // push out what's buffered now
+    bool connected() const { return !_gone; } // false once the client left
+  private:
+    friend class AsyncWebConsole;
+    CmdWriter(AsyncWebConsole& owner, uint32_t client, bool wait)
+      : _owner(owner), _client(client), _wait(wait) {}
+    bool _sendPart(size_t n);
+    AsyncWebConsole& _owner;
+    uint32_t _client;
+    bool     _wait;      // may block for queue room (not on the AsyncTCP task)
+    bool     _gone = false;
+    size_t   _len = 0;
+    char     _buf[kChunk];
+  };
+  using CmdStreamHandler = std::function<void(int, const String*, CmdWriter&)>;
+  // Same, with argv pointing into the tokenized line (valid for the call
+  // only): no String per argument, so a command costs no heap at all
+  using CmdArgvHandler = std::function<void(int, const char* const*, CmdWriter&)>;
+
+  // Output sink fed from the backlog ring: every sink has its own cursor and is
+  // written by the drain task at its own pace, so a slow one never delays the
+  // others. The mirror Print and the log file are built-in sinks.
+  class Sink {
+  public:
+    virtual ~Sink() {}
+    // Rendered text (timestamps applied); return how many bytes were taken,
+    // 0 when busy. The rest is offered again later. Should not block.
+    virtual size_t write(const char* data, size_t len) = 0;
+    // Per-line filter; fromIdf marks lines from the esp_log bridge
+    virtual bool accept(esp_log_level_t level, bool fromIdf) { (void)level; (void)fromIdf; return true; }
+  };
+  // What happens when the ring is about to overwrite lines a sink has not read:
+  // DropOldest lets them go (the sink gets "[AsyncWebConsole] skipped N bytes"),
+  // Block makes the drain task wait up to blockMs for the sink first.
+  enum class SinkPolicy : uint8_t { DropOldest, Block };
+
   struct Config {
     size_t   queueLen    = 8;      // messages in queue
     uint32_t taskStack   = 4096;    // drain task stack (bytes)
     UBaseType_t taskPrio = 3;       // drain task priority
+    BaseType_t taskCore  = tskNO_AFFINITY; // pin the drain task, e.g. 0 next to AsyncTCP
     Print*   mirrorOut   = nullptr; // mirror to this Print (e.g., &Serial); nullptr = no mirror
+    // Only write what mirrorOut->availableForWrite() reports (once it has ever
+    // reported room), so a slow UART is fed as it drains instead of stalling
+    uint32_t mirrorBlockMs = 0;     // >0: Block policy for the mirror sink
     bool     timestamps   = true;   // prefix lines with HH:MM:SS.mmm
     size_t   maxLineLen   = 512;    // Max length of line bufer including '\0'
+    // Preallocated producer ring: lines are formatted in place into length-prefixed
+    // records instead of a malloc per line (0 = malloc per line). Queue items then
+    // only carry a pointer into the ring, so queueLen can be raised cheaply.
+    size_t   ringBytes    = 0;
+
+    // Heap placement (ESP-IDF MALLOC_CAP_* flags, 0 = plain malloc). E.g.
+    // MALLOC_CAP_SPIRAM moves the buffers to PSRAM; when that allocation fails
+    // they fall back to the default heap. The backlog is placed by the constructor only.
+    uint32_t backlogCaps  = 0;      // backlog ring (also feeds WebSocket clients)
+    uint32_t bufferCaps   = 0;      // producer ring (ringBytes) and deferred-format render buffer
+    size_t   backlogFallbackBytes = 0; // cap the backlog at this size if it lands in internal RAM (0 = no cap)
 
     // File logging (optional)
     bool     fileLogEnable = false;
     const char* filePath   = "/console.log";
     size_t   maxFileSize   = 32 * 1024; // rotate when exceeded
     uint8_t  maxFiles      = 3;          // .1 .. .maxFiles
+    // Write-behind buffering: the file stays open and lines are written in
+    // batches when the buffer fills, after fileFlushMs, or on shutdown.
+    size_t   fileBufBytes  = 2048;       // 0 = write every line (file still kept open)
+    uint32_t fileFlushMs   = 1000;       // max age of buffered lines
+    // Write from a dedicated task (two buffers: one fills while the other is
+    // written), so flash stalls never delay WebSocket delivery. Lines that
+    // arrive while both buffers are busy are dropped and counted.
+    bool     fileTask      = false;
+    uint32_t fileBlockMs   = 0;          // >0: Block policy for the file sink
+    UBaseType_t fileTaskPrio = 1;
+    uint32_t fileTaskStack = 4096;
     // esp_log filtering for console/backlog: allow up to this level (inclusive)
     // Use ESP-IDF levels: ESP_LOG_NONE, _ERROR, _WARN, _INFO, _DEBUG, _VERBOSE
     esp_log_level_t syslogMaxLevel = ESP_LOG_VERBOSE;
@@ -33,9 +124,81 @@ public:
     // mirrorOut is skipped for IDF-originated messages to avoid duplication.
     bool     idfPassthrough = true;
 
-    // WebSocket batching
-    size_t   wsBatchMaxBytes   = 1024;   // batch buffer size before trimming
-    uint32_t wsFlushIntervalMs = 100;    // flush buffered messages at least every N ms
+    // Deferred formatting for the IDF log bridge: the shim only captures the
+    // flash-resident format pointer plus a compact copy of its arguments (%s
+    // strings are copied on enqueue) and the drain task does the vsnprintf.
+    // Non-flash formats and unsupported conversions fall back to formatting
+    // in place. Best paired with idfPassthrough = false.
+    bool     deferredFormat = false;
+
+    // Log storms. Each esp_log call site (format pointer) gets a token bucket
+    // of rateLimitBurst lines refilled at rateLimitPerSec (0 = off), checked
+    // in the bridge before formatting; the next line that gets through says
+    // how many were dropped. With coalesceRepeats, identical consecutive
+    // lines (IDF tick count aside) are published once, then as "last message
+    // repeated N times" when another line comes or after repeatFlushMs.
+    uint16_t rateLimitPerSec = 0;
+    uint16_t rateLimitBurst  = 20;
+    bool     coalesceRepeats = false;
+    uint32_t repeatFlushMs   = 1000;
+
+    // WebSocket delivery: each client reads from the backlog ring at its own pace
+    size_t   wsBatchMaxBytes   = 1024;   // max payload per frame when a client catches up
+    uint32_t wsFlushIntervalMs = 100;    // retry clients with a full send queue every N ms
+    // Lines the drain task takes per wakeup (1..32): they are published under
+    // one lock and go out as one WebSocket frame / sink write
+    size_t   drainBatch        = 16;
+    // Allow clients to request compact binary frames (connect with "?bin=1"):
+    // varint timestamp deltas, a level byte and the raw message instead of the
+    // rendered "[HH:MM:SS.mmm] " prefix and ANSI colors. The bundled page opts in.
+    bool     wsBinary          = false;
+    // Binary clients may additionally request LZ-compressed frames ("?bin=1&lz=1"):
+    // each frame is compressed once (shared by all clients at the same cursor)
+    // against a small static dictionary of IDF prefixes. Costs ~2 KB + 2 frames of RAM.
+    bool     wsCompress        = false;
+    // attachTo() also serves <routePath>/backlog (snapshot) and
+    // <routePath>/logfile?n=0..maxFiles (n omitted: JSON list), streamed in
+    // chunks and gzip'd on the fly for clients that accept it
+    bool     httpDownloads     = true;
+    // Cache-Control max-age for the bundled page. 0 = "no-cache": browsers
+    // revalidate every load, which costs a 304 thanks to the ETag. Larger
+    // values skip even that, but an OTA update that changes the page may then
+    // go unnoticed by a cached browser for that long.
+    uint32_t pageMaxAgeSec     = 0;
+    // This console's name in the channel list (<routePath>/config) once
+    // channels are added
+    const char* channelName    = "console";
+
+    // Remote syslog (RFC 5424) over UDP, fed from the backlog like the other
+    // sinks. Lines are packed into datagrams of up to udpMaxDatagram bytes,
+    // sent when full or udpFlushMs after the first line (0 = wsFlushIntervalMs).
+    const char* udpHost     = nullptr;   // IP address or host name; nullptr = off
+    uint16_t udpPort        = 514;
+    const char* udpHostname = nullptr;   // HOSTNAME field (nullptr = WiFi host name)
+    const char* udpAppName  = "awc";     // APP-NAME field
+    uint8_t  udpFacility    = 1;         // user-level messages
+    size_t   udpMaxDatagram = 1400;      // keep below the path MTU
+    uint32_t udpFlushMs     = 0;
+    bool     udpBatch       = true;      // false: one message per datagram (strict RFC 5426)
+    esp_log_level_t udpMaxLevel = ESP_LOG_VERBOSE;
+
+    // "grep" command: scans the backlog (and with --files the rotated log
+    // files) on its own task, below the drain task, in small chunks
+    UBaseType_t grepTaskPrio  = 1;
+    uint32_t grepTaskStack    = 4096;
+    uint16_t grepMaxMatches   = 200;
+
+    // Commands typed in the page run on a worker task, so a slow handler
+    // doesn't stall AsyncTCP. cmdQueueLen commands may wait; more are
+    // refused. 0 = run them inline in the WebSocket callback.
+    uint8_t  cmdQueueLen      = 4;
+    UBaseType_t cmdTaskPrio   = 1;
+    uint32_t cmdTaskStack     = 4096;
+
+    // Registers "awcbench <rate> <seconds> <len> [tasks] [--isr]": a load
+    // generator that reports throughput, drops, drain task busy time, stack
+    // and heap headroom, to size queueLen/taskStack/wsBatchMaxBytes on device
+    bool     benchCommand     = false;
   };
 
   // backlogBytes: maximum bytes stored in memory backlog (0 = disabled)
@@ -44,12 +207,25 @@ public:
   virtual ~AsyncWebConsole();
   void attachTo(AsyncWebServer& server, const char* routePath = "/");
 
+  // Channels: more consoles (each with its own backlog, queue, filters and
+  // sinks) whose output goes out on this console's WebSocket. Their frames
+  // start with "\x1d" and the channel digit (1..kMaxChannels); this console
+  // is channel 0 and unprefixed. Clients pick channels when connecting
+  // (?ch=0,2; default 0 only) and are sent nothing for the others. Commands
+  // always go to this console. A channel is not attached itself; name
+  // nullptr uses its Config::channelName. Either side may be destroyed
+  // first. Add channels before clients connect.
+  static constexpr size_t kMaxChannels = 4;
+  bool addChannel(AsyncWebConsole& channel, const char* name = nullptr);
+
   // Log API (thread-safe)
   // Enqueue a line for processing by the drain task
   void printf(const char* fmt, ...) __attribute__((format(printf, 2, 3)));
   void print(const char *s);
   void print(const String &s);
   
+  // Rewind the client's cursor to the oldest full backlog line; the drain task
+  // then streams the backlog from the ring in wsBatchMaxBytes frames.
   void sendBacklog(AsyncWebSocketClient* client);
   void setIndexHtml(const char* htmlProgmem);
 
@@ -73,14 +249,60 @@ public:
   void setSyslogMaxLevel(esp_log_level_t level);
   esp_log_level_t getSyslogMaxLevel() const { return _cfg.syslogMaxLevel; }
 
+  // Extra output sinks (e.g. UDP, MQTT); the sink must outlive its registration.
+  // New sinks start at the live end of the backlog.
+  bool addSink(Sink* sink, SinkPolicy policy = SinkPolicy::DropOldest, uint32_t blockMs = 0);
+  void removeSink(Sink* sink);
+
+  // Pipeline counters since boot or resetStats(), also served by the built-in
+  // "stats" command and as JSON at <routePath>/stats
+  static constexpr size_t kLatencyBuckets = 8;
+  struct Stats {
+    uint32_t enqueued;       // lines accepted by the queue
+    uint32_t droppedQueue;   // lines lost to a full queue
+    uint32_t droppedNoMem;   // lines lost to a full producer ring or failed allocation
+    uint32_t filtered;       // esp_log lines rejected by level/tag filters
+    uint32_t rateLimited;    // esp_log lines over their call site's rate limit
+    uint32_t repeated;       // repeats folded into "last message repeated"
+    uint32_t lines;          // lines published to the backlog
+    uint32_t bytes;
+    uint32_t backlogEvicted; // backlog bytes overwritten by newer lines
+    uint32_t wsSkipped;      // bytes overwritten before a WebSocket client read them
+    uint32_t sinkSkipped;    // same, for sinks (mirror, file, syslog, user)
+    uint32_t fileDropped;    // file bytes dropped while both buffers were busy
+    uint32_t udpDropped;     // syslog datagrams not sent
+    uint32_t queueDepth;     // messages waiting now
+    uint32_t queueHigh;      // most messages seen waiting
+    uint32_t latencyMaxUs;
+    // Enqueue -> handed to clients and sinks:
+    // <100us, <1ms, <5ms, <10ms, <50ms, <100ms, <500ms, longer
+    uint32_t latency[kLatencyBuckets];
+  };
+  Stats stats() const;
+  void resetStats();
+  String statsJson() const;
+
+  // Console output before the last reset (AWC_CRASHLOG_BYTES), as text under
+  // a "== previous boot (<reset reason>) ==" line; nullptr when there is none.
+  // Sent to the first WebSocket client and served at <routePath>/prevboot.
+  const char* previousBootLog() const { return _prevBoot; }
+  size_t previousBootLogLength() const { return _prevBootLen; }
+
   // Built-in command registry (optional)
   bool addCommand(const char* name, const char* args, const char* help, CmdArgHandler fn);
+  // Streaming variant: write the output to the CmdWriter as it is produced
+  bool addCommand(const char* name, const char* args, const char* help, CmdStreamHandler fn);
+  bool addCommand(const char* name, const char* args, const char* help, CmdArgvHandler fn);
   String helpText() const;
   virtual String dispatch(const String& raw);
 
   // esp_log filters (set IDF log levels)
   void setGlobalLogLevel(esp_log_level_t level);
   void setTagLogLevel(const char* tag, esp_log_level_t level);
+  // Console-only per-tag cap (IDF/UART levels stay as they are), e.g. keep
+  // "wifi" at warnings in the web console. Up to 16 tags; ESP_LOG_VERBOSE lifts it.
+  bool setConsoleTagLevel(const char* tag, esp_log_level_t level);
+  void clearConsoleTagLevels();
 
   // File logging controls
   void enableFileLog(const char* path = nullptr,
@@ -91,12 +313,26 @@ public:
                   size_t maxSize = 0, uint8_t maxFiles = 0);
 
 private:
-  // Backlog byte ring buffer (single allocation)
+  // Backlog byte ring buffer (single allocation). Lines written by _processLine
+  // start with a compact record header (timestamp + level) that is rendered
+  // per client at send time.
   void pushLineToBuffer(const char * s);
+  void _pushBytes(const char* s, size_t sl);
   char*   _logbuf = nullptr; // circular byte buffer
   size_t  _bufCap = 0;       // capacity in bytes
   size_t  _used   = 0;       // used bytes
   size_t  _head   = 0;       // index of oldest byte
+  uint32_t _wpos  = 0;       // absolute count of bytes ever written (wraps)
+  uint32_t _epoch = 0;       // random per boot: resume marks from another boot are ignored
+  bool    _backlogReplay = true; // false: ring only stages WebSocket output
+
+  // Crash log tail ring (AWC_CRASHLOG_BYTES), owned by the first instance
+  void _crashRecover();
+  void _crashAppend(const char* hdr, const char* s, size_t n);
+  bool    _crashOwner = false;
+  char*   _prevBoot = nullptr;   // previous boot's log, rendered at startup
+  size_t  _prevBootLen = 0;
+  bool    _prevBootSent = false; // already shown to a WebSocket client
   
   // Web
   AsyncWebServer*   _server = nullptr;
@@ -112,15 +348,43 @@ private:
                   uint8_t *data, size_t len);
                   
   // esp_log bridge
-  struct LogMsg { char * data; bool fromIdf; };
+  // One queued line and what the producer knew about it: the level (from the
+  // esp_log format, kLevelUnknown for printf lines), the core and micros().
+  // The drain task turns these into the backlog record header.
+  static constexpr uint8_t kLevelUnknown = 0xFF;
+  struct LogMsg { char * data; bool fromIdf; bool deferred; uint8_t level; uint8_t core; uint32_t t; };
   static int  _idfVprintfShim(const char* fmt, va_list ap);
   static bool _inIsr();
   static vprintf_like_t _origVprintf;
-  static AsyncWebConsole* _sink;
+  // Instances taking esp_log output, each through its own filters
+  static constexpr size_t kMaxBridges = 4;
+  static AsyncWebConsole* volatile _bridges[kMaxBridges];
+  static AsyncWebConsole* _etsSink;
+  int  _bridgeLine(const char* fmt, va_list ap); // formatted length, 0 if filtered
   using putc1_t = void (*)(char);
   static putc1_t _origPutc1;
   static void _etsPutcHook(char c);
   
+  // Producer byte ring (Config::ringBytes): records are reserved under a short
+  // ISR-safe critical section, formatted in place and released by the drain task.
+  struct RingRec { uint16_t size; uint16_t state; };
+  enum : uint16_t { RING_BUSY = 0, RING_FREE = 1 };
+  char*         _ring = nullptr;
+  size_t        _ringCap = 0;
+  size_t        _ringRd = 0;   // offset of the oldest record
+  size_t        _ringWr = 0;   // offset of the next reservation
+  size_t        _ringFill = 0; // reserved bytes (including wrap padding)
+  portMUX_TYPE  _ringMux = portMUX_INITIALIZER_UNLOCKED;
+  void  _ringInit(size_t bytes);
+  void  _ringDeinit();
+  char* _ringReserve(size_t payload);
+  void  _ringShrink(char* p, size_t payload);
+  void  _ringRelease(char* p);
+  bool  _ringOwns(const char* p) const { return _ring && p >= _ring && p < _ring + _ringCap; }
+  char* _allocLine(size_t n);
+  void  _freeLine(char* p);
+  char* _formatLine(const char* fmt, va_list ap);
+
   void _startDrainTask();
   void _stopDrainTask();
   static void _drainTask(void* arg);
@@ -135,37 +399,236 @@ private:
   // config
   Config            _cfg;
 
+  // stats: relaxed atomics, bumped by producers (also from ISRs) and the drain task
+  struct StatCounters {
+    std::atomic<uint32_t> enqueued{0}, droppedQueue{0}, droppedNoMem{0}, filtered{0};
+    std::atomic<uint32_t> rateLimited{0}, repeated{0};
+    std::atomic<uint32_t> lines{0}, bytes{0}, backlogEvicted{0}, wsSkipped{0}, sinkSkipped{0};
+    std::atomic<uint32_t> fileDropped{0}, udpDropped{0}, queueHigh{0}, latencyMaxUs{0};
+    std::atomic<uint32_t> latency[kLatencyBuckets] = {};
+  };
+  StatCounters _stats;
+  void _statLatency(uint32_t us);
+
+  // Storm control: per call site token buckets (producers, ISR-safe) and
+  // repeat folding (drain task)
+  struct RateSlot { const char* fmt; uint32_t ms; uint32_t tokens; uint32_t dropped; }; // tokens in 1/1000 lines
+  static constexpr size_t kRateSlots = 32;
+  RateSlot     _rate[kRateSlots] = {};
+  portMUX_TYPE _rateMux = portMUX_INITIALIZER_UNLOCKED;
+  bool     _rateAdmit(const char* fmt, uint32_t& dropped);
+  void     _repeatFlush();   // caller holds _mtx
+  void     _repeatTick();
+  uint32_t _repHash = 0;
+  uint32_t _repCount = 0;    // repeats not published yet
+  uint32_t _repFirstMs = 0;
+  uint8_t  _repLevel = 0;
+  bool     _repFromIdf = false;
+  bool     _repSeen = false;
+  bool     _repBypass = false; // publishing the repeat note itself
+
   // commands registry
-  struct CommandEntry { const char* name; const char* args; const char* help; CmdArgHandler fn; };
-  static constexpr size_t _maxCmds = 32;
+  // commands registry: sorted by name (case-insensitive), binary-searched;
+  // grows as needed. Register commands before clients can send any.
+  struct CommandEntry {
+    const char* name; const char* args; const char* help;
+    CmdArgHandler fn; CmdStreamHandler sfn; CmdArgvHandler vfn;
+  };
   static constexpr int _maxArgs = 12;
-  CommandEntry _cmds[_maxCmds] = {};
+  static constexpr size_t _cmdLineMax = 256; // longer WebSocket commands are refused
+  CommandEntry* _cmds = nullptr;
   size_t       _cmdCount = 0;
+  size_t       _cmdCap = 0;
+  bool   _addCmd(CommandEntry&& e);
+  size_t _cmdLowerBound(const char* name) const;
+  String _dispatchLine(char* line);
+  uint32_t     _cmdClient = 0; // WebSocket client whose command is being dispatched
+
+  // awcbench (Config::benchCommand): generator tasks and an optional timer ISR
+  struct BenchGen;
+  void _benchRun(int argc, const char* const* argv, CmdWriter& out);
+  static void _benchTaskFn(void* arg);
+  static void _benchIsr();
+  volatile bool _benchBusy = false;
+  std::atomic<uint32_t> _drainBusyUs{0}; // drain task time between wakeup and the next wait
+
+  // command worker: the queue holds the lines themselves (no per-command
+  // allocation); client 0 is the shutdown sentinel
+  struct CmdJob { uint32_t client; char line[_cmdLineMax]; };
+  QueueHandle_t _cmdQ = nullptr;
+  TaskHandle_t  _cmdTask = nullptr;
+  bool _cmdPost(uint32_t client, const uint8_t* data, size_t len);
+  void _cmdRun(uint32_t client, const String& line);
+  void _cmdStopTask();
+  static void _cmdTaskFn(void* arg);
+
+  // grep: one search at a time; matches go to the requesting client only
+  struct GrepJob;
+  String _grepStart(int argc, const String* argv);
+  void   _grepRun(GrepJob& job);
+  void   _grepFeed(GrepJob& job, size_t len, const char* label, bool last);
+  void   _grepEmit(GrepJob& job, const char* label, const char* line, size_t len);
+  bool   _grepSend(GrepJob& job);
+  void   _grepStopTask();
+  static void _grepTaskFn(void* arg);
+  volatile bool _grepBusy = false;
+  volatile bool _grepStop = false;
   
-  // file logging helpers
-  void _appendToFile(const char* data, size_t len);
-  void _rotateIfNeeded();
+  // file logging: write-behind buffers filled by the drain task and written
+  // either inline or by the file task; the handle and its size are owned by
+  // whichever context writes
+  bool _appendToFile(const char* data, size_t len); // false: both buffers busy, retry later
+  void _fileFlush(bool force);          // drain task: write/hand over buffered data
+  void _fileTick();
+  void _fileWrite(const char* data, size_t len);
+  void _fileClose();
+  void _fileStopTask();
+  static void _fileTaskFn(void* arg);
+  void _rotateIfNeeded(size_t incoming = 0); // rotate before the file would exceed maxFileSize
   size_t _currentFileSize();
+  File     _file;
+  const char* _fileOpenPath = nullptr; // path _file was opened with
+  size_t   _fileSize = 0;              // tracked size of the open file
+  char*    _fileBuf[2] = {nullptr, nullptr};
+  size_t   _fileBufCap = 0;
+  size_t   _fileFill = 0;              // bytes in _fileBuf[_fileActive]
+  uint8_t  _fileActive = 0;
+  volatile size_t _filePending = 0;    // bytes in _fileBuf[_filePendingBuf] awaiting the file task
+  uint8_t  _filePendingBuf = 0;
+  uint32_t _fileFirstMs = 0;           // when the oldest buffered byte arrived
+  uint32_t _fileDropped = 0;           // bytes dropped while both buffers were busy
+  TaskHandle_t _fileTaskHandle = nullptr;
+  volatile bool _fileTaskStop = false;
+
+  // remote syslog: one datagram being packed, flushed by the drain task
+  size_t _udpWrite(const char* data, size_t len);
+  void   _udpAppendLine(const char* line, size_t n);
+  void   _udpFlush();
+  void   _udpTick();
+  bool   _udpResolve();
+  void   _udpReset();
+  AsyncUDP* _udp = nullptr;
+  char*    _udpBuf = nullptr;
+  size_t   _udpCap = 0;
+  size_t   _udpLen = 0;
+  uint32_t _udpFirstMs = 0;
+  uint32_t _udpAddr = 0;               // resolved IPv4 address, 0 = not yet
+  uint32_t _udpResolveMs = 0;          // last failed lookup
+
+  // sinks: cursors into the backlog ring, each with a pending buffer holding
+  // rendered text the sink has not taken yet
+  class BuiltinSink;
+  struct SinkSlot {
+    Sink*    sink;
+    uint32_t pos;       // absolute backlog cursor
+    uint32_t skipped;
+    uint32_t blockMs;
+    SinkPolicy policy;
+    char*    buf;
+    size_t   cap, len, off;
+  };
+  static constexpr size_t _maxSinks = 8;
+  SinkSlot _sinks[_maxSinks] = {};
+  size_t   _sinkCount = 0;
+  SemaphoreHandle_t _sinkMtx = nullptr;
+  BuiltinSink* _mirrorSink = nullptr;
+  BuiltinSink* _fileSink = nullptr;
+  BuiltinSink* _udpSink = nullptr;
+  bool     _mirrorSawRoom = false; // mirrorOut has reported availableForWrite() > 0
+  bool _addSinkSlot(Sink* sink, SinkPolicy policy, uint32_t blockMs, bool live);
+  bool _pumpSinks();               // true while some sink is taking data but has more
+  bool _pumpSink(SinkSlot& s);
+  void _sinksMakeRoom(size_t n);   // Block policy: wait before overwriting unread lines; never under _mtx
+
+  // websocket delivery: per-client cursors into the backlog ring
+  struct WsClientSlot {
+    uint32_t id;       // AsyncWebSocketClient::id(), 0 = free slot
+    uint32_t pos;      // absolute backlog position of the next byte to send
+    uint32_t replayEnd; // backlog end at (re)connect; help follows once reached
+    uint32_t skipped;  // bytes overwritten before this client could read them
+    uint16_t gen;      // bumped when the cursor is reset outside the drain task
+    bool     held;     // connect/backlog in progress: no live output yet
+    bool     midLine;  // last frame did not end with '\n'
+    bool     helpPending;
+    bool     binary;   // client negotiated binary frames
+    bool     compress; // ... LZ-compressed (Config::wsCompress)
+    bool     marks;    // frames carry a resume mark (?resume)
+  };
+#ifdef DEFAULT_MAX_WS_CLIENTS
+  static constexpr size_t _wsMaxClients = DEFAULT_MAX_WS_CLIENTS;
+#else
+  static constexpr size_t _wsMaxClients = 8;
+#endif
+  WsClientSlot _wsClients[_wsMaxClients] = {};
+  int  _wsAttachClient(uint32_t id);
+  void _wsDetachClient(uint32_t id);
+  void _wsHoldClient(uint32_t id, bool hold);
+  bool _wsResume(int slot, const String& since);
+  // Channels (addChannel): the host forwards connects and disconnects
+  AsyncWebConsole* _wsHost = nullptr;   // set on a channel: its frames use the host's socket
+  uint8_t          _chanId = 0;         // 1..kMaxChannels on a channel
+  AsyncWebConsole* _channels[kMaxChannels] = {};
+  const char*      _chanNames[kMaxChannels] = {};
+  size_t           _chanCount = 0;
+  AsyncWebSocket&  _sock() { return _wsHost ? _wsHost->_ws : _ws; }
+  void _wsChannelJoin(AsyncWebSocketClient* cli, bool binary, bool compress, bool marks, const AsyncWebParameter* since);
+  bool _pumpWsClients(); // true while some client is still catching up
+  bool _pumpOutputs();   // clients and sinks; true while any is behind
+  bool _outputsBehind = false;
+  // Unsent data waiting on a full client queue or a busy sink: only then does
+  // the drain task wake every wsFlushIntervalMs, otherwise it blocks on the queue
+  bool _wsPending = false;
+  bool _sinksPending = false;
+  void _wakeDrain();
+  char   _backlogAt(uint32_t pos) const;
+  uint32_t _backlogFindNl(uint32_t from, uint32_t to) const; // first '\n' in [from, to) or to
+  void   _backlogCopy(uint32_t pos, char* dst, size_t len) const;
+  size_t _wsChunkLen(uint32_t pos, size_t cap, bool wholeLines = false) const;
+  // Frame builders; out == nullptr only measures
+  size_t _backlogRender(uint32_t pos, size_t len, bool lineStart, char* out, Sink* filter = nullptr) const;
+  size_t _backlogEncode(uint32_t pos, size_t len, char* out) const;
+  size_t _wsFrame(const WsClientSlot& c, size_t len, char* out) const;
+  AsyncWebSocketMessageBuffer* _wsBuildFrame(const WsClientSlot& c, size_t len, size_t maxLen);
+  uint8_t*  _lzBuf = nullptr;   // dictionary + raw frame + compressed output
+  size_t    _lzCap = 0;
+  uint16_t* _lzTable = nullptr; // match finder hash table
+  bool _wsTextAll(const char* a, size_t alen, const char* b = nullptr, size_t blen = 0);
 
-  // websocket batching helpers
-  void _queueWsBroadcast(const char* data, size_t len);
-  void _flushWsBroadcast(bool force);
-  void _trimWsBatch(size_t dropBytes);
-  void _sendPendingWsDrop(uint32_t now);
+  // HTTP downloads: chunked responses fed from the ring or an open File
+  struct Download;
+  struct GzipStream;
+  void   _sendDownload(AsyncWebServerRequest* r, int fileIndex); // -1: backlog
+  size_t _downloadFill(Download& dl, uint8_t* out, size_t maxLen);
+  size_t _downloadRead(Download& dl, char* out, size_t cap);
+  String _logFilesJson() const;
+  // Page: the bundled one pre-gzip'd with ETag/304, custom ones streamed
+  void   _sendPage(AsyncWebServerRequest* r);
 
   // helpers for rendering
-  String _formatTimestamp();
-  static int _tokenize(const String& in, String out[], int maxOut);
-  static esp_log_level_t _detectEspLogLevel(const String& s); // maps E/W/I/D/V to ESP_LOG_* (unknown -> ESP_LOG_NONE)
-  bool        _allowSyslog(const char * s) const;
+  static int _tokenize(char* line, char* argv[], int maxArgs);
+  static esp_log_level_t _detectEspLogLevel(const char* s); // maps E/W/I/D/V to ESP_LOG_* (unknown -> ESP_LOG_NONE)
+  bool        _allowLevel(const char * s, esp_log_level_t lvl) const; // level caps and console tag caps
+  // console tag filters: open addressing on the tag hash, one word per entry
+  // ((hash & ~0xFF) | (level + 1), 0 = empty) so the shim reads them lock-free
+  static constexpr size_t _maxTagFilters = 16;
+  volatile uint32_t _tagFilters[_maxTagFilters] = {};
+  volatile uint8_t  _tagFilterCount = 0;
+  static uint32_t    _tagHash(const char* tag, size_t n);
+  static const char* _lineTag(const char* s, size_t& n); // "X (123) tag: " -> tag
+  esp_log_level_t    _tagLimit(const char* s) const;
 
   // queue helpers
-  void _processLine(char * data, bool fromIdf = false);
-  bool _enqueueRaw(char * data, bool fromIdf = false);
+  void _processLine(char * data, const LogMsg& meta); // caller holds _mtx, made room first
+  bool _enqueueRaw(char * data, bool fromIdf = false, bool deferred = false, uint8_t level = kLevelUnknown);
+  void _handleMsg(LogMsg& msg);   // caller holds _mtx, made room first
+  size_t _msgRoom(const LogMsg& msg) const; // ring bytes msg may publish (upper bound)
+  void _handleBatch(LogMsg& first); // first + up to drainBatch-1 more, one lock, one pump
+  static constexpr size_t _maxDrainBatch = 32;
+
+  // deferred formatting (Config::deferredFormat)
+  char* _captureDeferred(const char* fmt, va_list ap);
+  char*  _renderBuf = nullptr; // drain-side render target for deferred records
+  size_t _renderCap = 0;
 
-  String           _wsBatch;
-  uint32_t         _lastWsFlushMs = 0;
-  bool             _wsDropPending = false;
-  String           _wsDropMessage;
 
 };
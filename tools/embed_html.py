@@ -0,0 +1,43 @@
+#!/usr/bin/env python3
+"""Regenerate web/console_html_gz.h from web/console.html.
+
+The page is stored gzip'd (mtime 0, so the output only changes with the
+page) and served as-is with Content-Encoding: gzip. The ETag is a hash of
+the compressed bytes. Run after editing web/console.html:
+
+    python3 tools/embed_html.py
+"""
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SRC = os.path.join(ROOT, "web", "console.html")
+DST = os.path.join(ROOT, "web", "console_html_gz.h")
+
+with open(SRC, "rb") as f:
+    raw = f.read()
+# console.html is a raw string literal for the uncompressed copy: strip the wrapper
+head, tail = b'R"HTML(\n', b')HTML"\n'
+if raw.startswith(head) and raw.endswith(tail):
+    raw = raw[len(head):-len(tail)]
+
+gz = gzip.compress(raw, compresslevel=9, mtime=0)
+etag = hashlib.sha1(gz).hexdigest()[:16]
+
+lines = [
+    "// Generated by tools/embed_html.py from web/console.html - do not edit.",
+    "#pragma once",
+    "",
+    '#define AWC_INDEX_HTML_GZ_ETAG "W/\\"%s\\""' % etag,
+    "",
+    "// %d bytes (%d uncompressed)" % (len(gz), len(raw)),
+    "static const uint8_t kIndexHtmlGz[] PROGMEM = {",
+]
+for i in range(0, len(gz), 16):
+    lines.append("  " + ", ".join("0x%02x" % b for b in gz[i:i + 16]) + ",")
+lines += ["};", ""]
+
+with open(DST, "w", newline="\n") as f:
+    f.write("\n".join(lines))
+print("%s: %d -> %d bytes, ETag %s" % (os.path.relpath(DST, ROOT), len(raw), len(gz), etag))
@@ -0,0 +1,449 @@
+// Generated by tools/embed_html.py from web/console.html - do not edit.
+#pragma once
+
+#define AWC_INDEX_HTML_GZ_ETAG "W/\"76a832e154f9b8ff\""
+
+// 7055 bytes (23980 uncompressed)
+static const uint8_t kIndexHtmlGz[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xe5, 0x3c, 0x6b, 0x73, 0xdb, 0x38,
+  0x92, 0xdf, 0xf3, 0x2b, 0x10, 0xef, 0x6c, 0x44, 0x8d, 0x25, 0x59, 0x52, 0xfc, 0x94, 0x1f, 0xa9,
+  0xc4, 0xc9, 0xd4, 0x64, 0x2f, 0x93, 0xa4, 0xe2, 0xec, 0xce, 0xdd, 0x2a, 0xba, 0x0c, 0x1f, 0xa0,
+  0xc4, 0x31, 0x45, 0x72, 0x49, 0xca, 0xb2, 0x93, 0xf1, 0x7f, 0xbf, 0xee, 0x06, 0x40, 0x02, 0x20,
+  0x25, 0x67, 0x66, 0xb6, 0xae, 0xae, 0xea, 0x52, 0x15, 0x5b, 0x02, 0x1a, 0x8d, 0x46, 0xa3, 0xbb,
+  0xd1, 0xdd, 0x68, 0xf8, 0xec, 0x71, 0x90, 0xfa, 0xe5, 0x5d, 0xc6, 0xd9, 0xa2, 0x5c, 0xc6, 0x17,
+  0x8f, 0xce, 0xf0, 0x17, 0x8b, 0xdd, 0x64, 0x7e, 0xbe, 0xc3, 0x93, 0x1d, 0x6c, 0xe0, 0x6e, 0x70,
+  0xf1, 0x88, 0xb1, 0xb3, 0x25, 0x2f, 0x5d, 0xe6, 0x2f, 0xdc, 0xbc, 0xe0, 0xe5, 0xf9, 0xce, 0xaa,
+  0x0c, 0xfb, 0xc7, 0x3b, 0x75, 0x47, 0xe2, 0x2e, 0xf9, 0xf9, 0xce, 0x4d, 0xc4, 0xd7, 0x59, 0x9a,
+  0x97, 0x3b, 0xcc, 0x4f, 0x93, 0x92, 0x27, 0x00, 0xb8, 0x8e, 0x82, 0x72, 0x71, 0x1e, 0xf0, 0x9b,
+  0xc8, 0xe7, 0x7d, 0xfa, 0xd2, 0x8b, 0x92, 0xa8, 0x8c, 0xdc, 0xb8, 0x5f, 0xf8, 0x6e, 0xcc, 0xcf,
+  0x47, 0x02, 0x4b, 0x19, 0x95, 0x31, 0xbf, 0x78, 0x75, 0xf5, 0xfe, 0xe9, 0x98, 0xfd, 0xcc, 0x3d,
+  0x76, 0x99, 0x26, 0x45, 0x1a, 0xf3, 0xb3, 0x3d, 0xd1, 0x81, 0x20, 0x45, 0x79, 0x27, 0x3e, 0x31,
+  0x36, 0xc9, 0xd3, 0xb4, 0x64, 0x5f, 0x59, 0x08, 0xd3, 0xf4, 0x43, 0x77, 0x19, 0xc5, 0x77, 0x13,
+  0xb6, 0x8a, 0xfa, 0xcb, 0x34, 0x49, 0x8b, 0xcc, 0xf5, 0x79, 0x8f, 0xfd, 0xc4, 0x93, 0x38, 0xed,
+  0x49, 0x3c, 0x6e, 0xd1, 0x63, 0x55, 0xdf, 0x29, 0xbb, 0x27, 0x24, 0xb8, 0xd6, 0x1e, 0xf3, 0xd2,
+  0xe0, 0x0e, 0x30, 0x2d, 0x78, 0x34, 0x5f, 0x94, 0x13, 0x36, 0x1a, 0x0e, 0xff, 0xaa, 0x00, 0x44,
+  0x17, 0x7d, 0x64, 0x6c, 0xe9, 0xe6, 0xf3, 0x28, 0x99, 0xb0, 0xe1, 0xa9, 0x6c, 0xf0, 0x5c, 0xff,
+  0x7a, 0x9e, 0xa7, 0xab, 0x24, 0x98, 0xb0, 0xbf, 0x0c, 0xbd, 0x61, 0x38, 0xda, 0x57, 0x5d, 0x7e,
+  0x1a, 0xa7, 0x39, 0xb4, 0xf2, 0x43, 0x1e, 0x84, 0x4f, 0x55, 0xeb, 0x32, 0x4a, 0xfa, 0xda, 0x34,
+  0x37, 0x0b, 0xd5, 0x11, 0x44, 0x45, 0x16, 0xbb, 0xb0, 0x82, 0x30, 0xe6, 0xb7, 0xaa, 0x11, 0x3f,
+  0xf7, 0x83, 0x28, 0xe7, 0x7e, 0x19, 0xa5, 0x30, 0x2f, 0xe0, 0x5c, 0x2d, 0x13, 0xd1, 0x2b, 0xe9,
+  0x87, 0xad, 0xe1, 0x79, 0x45, 0x60, 0xe6, 0x06, 0x41, 0x94, 0xcc, 0x01, 0xf7, 0x38, 0xbb, 0x65,
+  0xa3, 0xc3, 0xec, 0xb6, 0x95, 0xd2, 0xd1, 0x68, 0x74, 0x34, 0xae, 0x68, 0xf2, 0xd2, 0x1c, 0x70,
+  0xf4, 0xbd, 0xb4, 0x2c, 0xd3, 0x25, 0x0c, 0x85, 0x91, 0xc0, 0xae, 0x28, 0x00, 0xb8, 0x70, 0x7c,
+  0xf2, 0xf4, 0xe8, 0x61, 0x12, 0xd7, 0xb9, 0x9b, 0x4d, 0x18, 0xfe, 0x54, 0xcd, 0x6e, 0x1c, 0xcd,
+  0x93, 0x7e, 0x54, 0xf2, 0x65, 0x01, 0x64, 0x83, 0x14, 0xf0, 0x5c, 0x75, 0xfd, 0xba, 0x2a, 0xca,
+  0x28, 0xbc, 0xeb, 0x4b, 0xf1, 0x98, 0x30, 0xda, 0x90, 0xbe, 0xc7, 0xcb, 0x35, 0xe7, 0x89, 0x82,
+  0x9a, 0x23, 0x46, 0x5c, 0x85, 0xbe, 0xda, 0x41, 0x51, 0xba, 0xe5, 0xaa, 0xb0, 0xf6, 0xa3, 0x9f,
+  0x2b, 0x7e, 0xd6, 0xcb, 0x25, 0xa1, 0x58, 0x4b, 0x46, 0x1f, 0x0d, 0x87, 0x2d, 0x58, 0x06, 0xe9,
+  0x35, 0xec, 0xb9, 0xda, 0xa6, 0xf1, 0xd8, 0x3f, 0x38, 0xa8, 0xc4, 0x42, 0x81, 0xf0, 0x3c, 0xd7,
+  0x60, 0x78, 0xb8, 0x0f, 0xff, 0x6c, 0x98, 0xcc, 0x5d, 0x15, 0x3c, 0xd0, 0xc0, 0xc2, 0x83, 0x13,
+  0x3e, 0xf4, 0x2a, 0x30, 0xb1, 0x45, 0xfd, 0xa5, 0x1b, 0x25, 0x15, 0xe1, 0xad, 0xac, 0xdc, 0xc2,
+  0x33, 0xc1, 0x8d, 0xa1, 0xc5, 0x0d, 0x89, 0xd9, 0x25, 0xe9, 0x28, 0xb6, 0x23, 0x27, 0x0c, 0xc7,
+  0xd9, 0x1f, 0xde, 0x37, 0x31, 0xe5, 0x5f, 0xe2, 0x74, 0x5e, 0xcd, 0x83, 0x28, 0x80, 0xaa, 0x36,
+  0xd1, 0xae, 0x14, 0x24, 0xbd, 0xe1, 0x79, 0x18, 0xa7, 0xeb, 0x09, 0x73, 0x57, 0x65, 0xaa, 0x5a,
+  0xb3, 0xb4, 0x88, 0x84, 0x44, 0xe7, 0x3c, 0x76, 0xcb, 0xe8, 0x86, 0xdb, 0x93, 0xf4, 0xf3, 0x74,
+  0x5d, 0xaf, 0xa8, 0x86, 0x77, 0x3d, 0x10, 0xcd, 0x55, 0xc9, 0x15, 0xa6, 0x98, 0x87, 0xfa, 0x74,
+  0x65, 0x9a, 0x69, 0xdf, 0x90, 0x22, 0x32, 0x37, 0x52, 0xa5, 0x65, 0xb3, 0x6c, 0x5a, 0xba, 0xb7,
+  0x4a, 0x06, 0x6b, 0x4d, 0xb8, 0xed, 0x17, 0xd1, 0x17, 0xd2, 0xa0, 0x4a, 0x2b, 0x2a, 0x96, 0x55,
+  0xca, 0x35, 0x34, 0x34, 0x6b, 0x1d, 0xc5, 0x71, 0x1f, 0x8c, 0x62, 0x32, 0xe7, 0x13, 0x56, 0xe6,
+  0x6e, 0x52, 0x84, 0x69, 0xbe, 0x34, 0x36, 0x2a, 0x8e, 0x12, 0x0e, 0x02, 0xb2, 0x5e, 0x00, 0x63,
+  0xfb, 0x24, 0xee, 0x13, 0x96, 0xe5, 0x20, 0x6d, 0x95, 0x29, 0x18, 0xec, 0xf3, 0xe5, 0x29, 0x43,
+  0xb8, 0xbe, 0xd5, 0xa6, 0x84, 0xed, 0xae, 0xd0, 0x44, 0xec, 0x84, 0xfb, 0x5e, 0x18, 0x56, 0x9d,
+  0xa6, 0x98, 0x86, 0xe1, 0xb1, 0x7b, 0xec, 0x56, 0x9d, 0x20, 0xe6, 0xfa, 0x48, 0x18, 0xe7, 0x1e,
+  0x57, 0x9d, 0x65, 0xa1, 0x77, 0x1e, 0xbb, 0xde, 0x7e, 0x08, 0x9d, 0x29, 0x90, 0x18, 0x95, 0x20,
+  0x41, 0x83, 0x93, 0x0a, 0xd2, 0x5f, 0xe8, 0x90, 0xfe, 0xbe, 0x77, 0x10, 0x06, 0x55, 0xa7, 0x97,
+  0xc6, 0x81, 0x32, 0xc5, 0x4a, 0xeb, 0x0e, 0x41, 0xeb, 0x54, 0x7f, 0x10, 0x2d, 0xa1, 0xbb, 0x46,
+  0x7b, 0x74, 0x50, 0x75, 0x45, 0x25, 0xc8, 0x9c, 0xaf, 0x06, 0x93, 0x7d, 0x9f, 0x30, 0xd1, 0x58,
+  0xc1, 0x80, 0xd5, 0xe2, 0xb9, 0x64, 0x62, 0xc9, 0x6f, 0xcb, 0x7e, 0xc0, 0xfd, 0x34, 0x77, 0x85,
+  0x48, 0x54, 0x9d, 0x15, 0x78, 0x38, 0xef, 0x7b, 0x31, 0xd8, 0x3b, 0x8d, 0xde, 0x91, 0x0b, 0xb6,
+  0xcc, 0xd3, 0x21, 0x72, 0x53, 0x67, 0x4d, 0x9e, 0x41, 0xff, 0x3c, 0x07, 0x6b, 0xb4, 0x99, 0x71,
+  0x00, 0x71, 0xc7, 0x63, 0x90, 0x6c, 0x43, 0xf1, 0x83, 0xc3, 0x23, 0xcf, 0x24, 0x63, 0xc5, 0x37,
+  0x6f, 0x1b, 0x00, 0x2c, 0xdd, 0x39, 0xc8, 0x9f, 0xab, 0x1b, 0x99, 0x91, 0x7b, 0x68, 0xc2, 0xf8,
+  0x77, 0xae, 0x4e, 0xc8, 0x91, 0xc7, 0x9f, 0x86, 0xfb, 0x3a, 0x00, 0xc9, 0x95, 0x8e, 0x42, 0x1c,
+  0x39, 0x3a, 0x1d, 0x64, 0x22, 0x1b, 0x5c, 0x81, 0x4d, 0x3c, 0x38, 0x6c, 0x03, 0xb4, 0x99, 0x73,
+  0xe2, 0x9d, 0x78, 0x2d, 0x60, 0x36, 0x8f, 0xbc, 0x71, 0x18, 0x7a, 0x41, 0x0b, 0x60, 0x93, 0x55,
+  0x21, 0x1f, 0x9a, 0xfc, 0xae, 0x48, 0x34, 0x38, 0xe6, 0x1d, 0x06, 0x47, 0x26, 0x37, 0x24, 0x5c,
+  0x93, 0x71, 0xe1, 0xc8, 0x3b, 0x6e, 0x05, 0xb5, 0xf8, 0x77, 0xe2, 0xf1, 0x93, 0x56, 0x38, 0x9b,
+  0x8d, 0x21, 0xfd, 0xab, 0x65, 0xbc, 0x96, 0xaa, 0xb6, 0xc3, 0x54, 0x03, 0x13, 0xdc, 0x33, 0x80,
+  0x9e, 0x7a, 0x43, 0x77, 0xe8, 0xea, 0x40, 0x8a, 0x77, 0xa6, 0x0b, 0xe1, 0x3e, 0xf5, 0x46, 0x06,
+  0x58, 0xc5, 0x39, 0x0b, 0xdd, 0x38, 0x34, 0xd1, 0x49, 0xbe, 0x59, 0xd8, 0x46, 0xe1, 0x53, 0x4f,
+  0x87, 0xaa, 0xb9, 0x66, 0x00, 0x8e, 0x5d, 0x9c, 0x58, 0x07, 0x94, 0x3c, 0xb3, 0xd0, 0x8d, 0x2d,
+  0x74, 0x8a, 0x63, 0x06, 0xd8, 0x49, 0xe8, 0x1e, 0x7a, 0x63, 0x83, 0x36, 0x53, 0xfa, 0xcc, 0x95,
+  0x1c, 0xed, 0x8f, 0x0e, 0x46, 0x2d, 0xd0, 0x2d, 0x4c, 0x3c, 0x80, 0xf5, 0x8c, 0xc2, 0x16, 0xd8,
+  0x56, 0x5e, 0x8e, 0xc2, 0x03, 0x77, 0xec, 0xb5, 0x40, 0xb7, 0xb3, 0xf4, 0xc0, 0xdd, 0xf7, 0x5a,
+  0x91, 0xb7, 0x71, 0x16, 0xf9, 0x7a, 0xe0, 0xb6, 0x00, 0x6f, 0x60, 0x30, 0xec, 0x6a, 0xd8, 0x0a,
+  0xdf, 0xc6, 0xe7, 0x51, 0xb8, 0xdf, 0x8e, 0xbc, 0x95, 0xdd, 0xbe, 0x17, 0x1c, 0x70, 0x60, 0xa0,
+  0x92, 0x5a, 0xe9, 0x85, 0xca, 0xd1, 0x78, 0x14, 0xfd, 0x3e, 0xc7, 0x60, 0x8b, 0x0b, 0x29, 0x4e,
+  0x44, 0x3a, 0x63, 0x37, 0x3a, 0x89, 0xa6, 0xc4, 0xf0, 0xd1, 0xfe, 0x78, 0xd8, 0x3c, 0xf5, 0xc1,
+  0x01, 0xf4, 0xaf, 0xef, 0x6a, 0xbc, 0xc2, 0xf1, 0x34, 0x9c, 0xb4, 0x28, 0xc9, 0x56, 0xe5, 0x14,
+  0xc3, 0x92, 0x73, 0xb4, 0xf8, 0xb3, 0x4d, 0x5e, 0x47, 0x4d, 0xee, 0x10, 0xc9, 0x1d, 0x6f, 0xf0,
+  0x78, 0x87, 0xde, 0x68, 0x5c, 0x53, 0xd2, 0xee, 0x9b, 0x8b, 0xf5, 0x6d, 0x5b, 0x9b, 0x60, 0x40,
+  0xee, 0x06, 0xd1, 0xaa, 0x68, 0xfa, 0x63, 0xde, 0x0a, 0xd6, 0x91, 0xb4, 0xf8, 0xe2, 0x44, 0xd9,
+  0xbe, 0xcd, 0x48, 0x3d, 0x8c, 0xd8, 0x84, 0xd8, 0x5a, 0xc5, 0x18, 0xac, 0x35, 0xf7, 0xec, 0x55,
+  0xa0, 0x91, 0x52, 0x4d, 0xab, 0xbc, 0xc0, 0xb6, 0x2c, 0x8d, 0x6c, 0xd7, 0x4d, 0x50, 0x37, 0x01,
+  0x19, 0x70, 0xbd, 0x98, 0x74, 0xab, 0x3e, 0x8e, 0xe1, 0x34, 0x56, 0x23, 0x93, 0xb4, 0xec, 0xbb,
+  0xa8, 0x1f, 0x3c, 0x38, 0xdd, 0xe0, 0x67, 0x6e, 0x5a, 0xe7, 0xb1, 0xb1, 0x01, 0x72, 0xec, 0x35,
+  0xe7, 0x59, 0x3f, 0x76, 0x3d, 0x1e, 0xff, 0x39, 0xe7, 0xf7, 0xd0, 0xf2, 0xed, 0xc1, 0x4d, 0x03,
+  0x3f, 0x61, 0x38, 0x38, 0xc9, 0xf9, 0xd2, 0x66, 0x48, 0x30, 0x0a, 0x0e, 0x82, 0x8a, 0x4d, 0xe0,
+  0x9d, 0xe7, 0xfd, 0x82, 0xc7, 0x10, 0x44, 0xe1, 0xf2, 0x12, 0xcd, 0xd7, 0x3c, 0xdb, 0x93, 0xf1,
+  0xe4, 0xd9, 0x9e, 0x88, 0x71, 0xcf, 0x30, 0xdc, 0xa3, 0x40, 0x53, 0xac, 0x59, 0x44, 0x9a, 0x67,
+  0x41, 0x74, 0xc3, 0x7c, 0x08, 0x20, 0x8b, 0xf3, 0x1d, 0xcd, 0x9b, 0xdf, 0xb9, 0x90, 0x33, 0x9c,
+  0x81, 0x4b, 0x97, 0xb0, 0x28, 0x38, 0xdf, 0x11, 0x21, 0xc1, 0x8e, 0x02, 0x96, 0xe1, 0x0a, 0xb8,
+  0x67, 0x3b, 0x17, 0x53, 0xf0, 0x35, 0x13, 0x0c, 0xe4, 0x92, 0xf9, 0x0c, 0xe6, 0x85, 0x11, 0xd5,
+  0x70, 0xaf, 0x2d, 0xe6, 0xf5, 0xe4, 0xdc, 0x7b, 0x30, 0xf9, 0x46, 0x32, 0xe4, 0x96, 0xd4, 0x94,
+  0xc8, 0xbd, 0x41, 0x5a, 0xfc, 0x98, 0xbb, 0xe0, 0xbf, 0x96, 0xc9, 0x0e, 0x23, 0x35, 0xda, 0x11,
+  0x7d, 0x3b, 0x4c, 0x89, 0xc0, 0xc5, 0x25, 0x42, 0xc0, 0x4c, 0xd4, 0xde, 0x86, 0xa2, 0x4c, 0xe7,
+  0xf3, 0x98, 0x6f, 0xc5, 0xf1, 0x1e, 0xa3, 0x9f, 0x06, 0x0e, 0xb1, 0xe1, 0x92, 0xd6, 0x5a, 0x04,
+  0x76, 0x2e, 0xce, 0x48, 0xaf, 0x09, 0x39, 0x35, 0x8b, 0xe0, 0x49, 0x61, 0xf7, 0x17, 0xdc, 0xbf,
+  0x06, 0x8f, 0x7b, 0xe7, 0x82, 0xfd, 0x07, 0xf4, 0xa2, 0xc3, 0x1c, 0x73, 0x26, 0x60, 0xce, 0xf6,
+  0x08, 0x45, 0x93, 0xe7, 0xe8, 0x7a, 0x27, 0x3c, 0xae, 0xb9, 0x6e, 0xf3, 0x46, 0xe7, 0x76, 0xc5,
+  0x4e, 0xb1, 0xe3, 0x62, 0x87, 0x89, 0xb1, 0x88, 0x0a, 0x02, 0x8f, 0x1d, 0x96, 0x03, 0xfb, 0xe5,
+  0x47, 0x37, 0x8f, 0xdc, 0x7e, 0x0c, 0xe1, 0xc9, 0xf9, 0x4e, 0x06, 0x06, 0xa1, 0xe4, 0x80, 0x4c,
+  0x83, 0x15, 0xae, 0x7c, 0x8e, 0x33, 0x20, 0x56, 0xa3, 0x0b, 0xe3, 0x97, 0xaa, 0xa3, 0x9a, 0x94,
+  0xcc, 0x31, 0x82, 0x84, 0x3b, 0x14, 0x10, 0xf9, 0xe9, 0x32, 0x8b, 0x79, 0x09, 0xf8, 0xd3, 0x30,
+  0x94, 0xbb, 0xa8, 0xb1, 0xc8, 0x5f, 0x56, 0xac, 0x41, 0x23, 0xb8, 0xc3, 0x40, 0x6f, 0x7c, 0xbe,
+  0x00, 0x67, 0x9b, 0xe7, 0xb8, 0xce, 0x38, 0x53, 0x63, 0xb4, 0x4d, 0xd3, 0x76, 0xab, 0x58, 0x79,
+  0xcb, 0xa8, 0xdc, 0xb9, 0xb8, 0xe2, 0x49, 0xa0, 0xef, 0xd1, 0xd9, 0x1e, 0x12, 0x22, 0x12, 0x2a,
+  0x7e, 0x1e, 0x65, 0xa5, 0xc0, 0x02, 0x12, 0x5a, 0x94, 0x0c, 0xa8, 0x7f, 0x15, 0xb3, 0x73, 0x16,
+  0xa4, 0xfe, 0x6a, 0x09, 0x8a, 0x38, 0x98, 0xf3, 0xf2, 0x55, 0xcc, 0xf1, 0xe3, 0x8b, 0xbb, 0xd7,
+  0x81, 0xd3, 0x01, 0x80, 0x4e, 0xf7, 0x54, 0x1b, 0x21, 0xd8, 0xf0, 0xe0, 0x20, 0xc9, 0x2e, 0x73,
+  0x2c, 0xf2, 0xe9, 0xe1, 0x91, 0x08, 0x65, 0xcd, 0x49, 0xaa, 0xb5, 0x7d, 0xa4, 0x80, 0x31, 0xc7,
+  0xe1, 0xc2, 0xb7, 0x8f, 0x0a, 0xcd, 0x01, 0xb4, 0x1b, 0xdb, 0x47, 0xc0, 0x36, 0x99, 0x63, 0x04,
+  0xa7, 0xb7, 0x0f, 0x82, 0x6d, 0x32, 0x07, 0x91, 0xbe, 0xbe, 0x28, 0x93, 0xad, 0x33, 0x29, 0x9d,
+  0x36, 0x87, 0x0a, 0x3d, 0x7d, 0x60, 0x6c, 0xad, 0xcc, 0xe6, 0x60, 0xd4, 0xc3, 0x4b, 0xa9, 0x78,
+  0xdb, 0xc6, 0x6b, 0xfa, 0x6a, 0x11, 0x2e, 0x15, 0xf0, 0x01, 0x26, 0x49, 0x28, 0x73, 0xec, 0x22,
+  0x2a, 0xca, 0x34, 0xbf, 0x83, 0x81, 0xd3, 0x99, 0x68, 0xdf, 0xdb, 0x63, 0x6f, 0x20, 0x98, 0x2b,
+  0x18, 0xea, 0x1d, 0x70, 0x9f, 0xb9, 0x2c, 0x07, 0x9b, 0x09, 0x41, 0x69, 0x12, 0xdf, 0xb1, 0x72,
+  0xc1, 0x49, 0x64, 0xe0, 0x1b, 0x03, 0xd1, 0x45, 0xb7, 0x8f, 0xdf, 0x46, 0xb4, 0x4d, 0xd4, 0xf7,
+  0xf2, 0xdd, 0x4f, 0x1a, 0xf6, 0x9f, 0x9e, 0xff, 0xe7, 0xe7, 0x37, 0xaf, 0xdf, 0xbe, 0xba, 0x02,
+  0xfc, 0xeb, 0x28, 0x09, 0xd2, 0xf5, 0xe0, 0xf3, 0xe7, 0xe7, 0x3f, 0x5f, 0x7e, 0xae, 0x3b, 0x7e,
+  0xfb, 0x0d, 0x73, 0x03, 0x43, 0x95, 0x21, 0x12, 0xe3, 0xde, 0x3f, 0x7f, 0x09, 0x23, 0x46, 0x63,
+  0xbd, 0xed, 0xdd, 0x3f, 0x5e, 0x7d, 0xb8, 0xba, 0x7c, 0xfe, 0x16, 0x3b, 0x0c, 0xe0, 0xcb, 0x37,
+  0x88, 0x7e, 0xda, 0xe9, 0xf4, 0x58, 0x07, 0xa2, 0x74, 0xfc, 0x05, 0x06, 0x1f, 0x7f, 0xa5, 0xd7,
+  0x9d, 0x99, 0x0e, 0x19, 0xd3, 0xba, 0xce, 0x59, 0xc2, 0xd7, 0xec, 0x79, 0x9e, 0xbb, 0x77, 0x4e,
+  0x45, 0x47, 0xd7, 0x86, 0xbb, 0x8c, 0x15, 0xe4, 0xdf, 0xe1, 0x28, 0x3f, 0x7e, 0x10, 0x7c, 0xf1,
+  0x30, 0x34, 0x18, 0x1a, 0x82, 0xfd, 0x98, 0x42, 0x74, 0x0d, 0xe0, 0x10, 0x9e, 0x03, 0xb3, 0x05,
+  0x51, 0xfc, 0x86, 0xe7, 0x2c, 0x5b, 0x15, 0x0b, 0x3c, 0xf6, 0x29, 0xd2, 0x4e, 0x68, 0x03, 0x0a,
+  0xe6, 0x96, 0xf0, 0xf1, 0xaf, 0x35, 0x2b, 0x0d, 0x54, 0x97, 0xe0, 0x98, 0x94, 0x84, 0xaa, 0x6a,
+  0xc6, 0x2c, 0x6f, 0x09, 0xfe, 0x05, 0xe1, 0xa7, 0xed, 0x0c, 0xf2, 0x34, 0xcb, 0xa0, 0x25, 0xcc,
+  0xd3, 0x25, 0x6d, 0x12, 0x78, 0x90, 0xac, 0x88, 0x12, 0x9f, 0xd3, 0x37, 0x30, 0xda, 0x60, 0x06,
+  0x38, 0x46, 0xf1, 0x15, 0x92, 0x30, 0x25, 0x17, 0xfd, 0x9c, 0x95, 0xf9, 0x8a, 0x13, 0x99, 0xe4,
+  0x32, 0xc2, 0x48, 0x1a, 0x22, 0x3c, 0x46, 0x88, 0xfc, 0xcb, 0x28, 0xa6, 0x06, 0x3c, 0xe3, 0x51,
+  0x1e, 0x60, 0x58, 0xc1, 0x56, 0x59, 0x85, 0x07, 0x44, 0xe5, 0x47, 0x93, 0x3c, 0x31, 0xd1, 0x7b,
+  0xf8, 0x09, 0x42, 0x05, 0x5d, 0xa1, 0x1b, 0x17, 0x5c, 0xe7, 0x66, 0x96, 0xa6, 0xb1, 0x26, 0x8e,
+  0x38, 0x06, 0x85, 0xf4, 0x35, 0x0c, 0x43, 0xf5, 0xe8, 0x8f, 0xea, 0x76, 0xdf, 0xcd, 0x95, 0xe8,
+  0x4a, 0xc9, 0xcd, 0xdc, 0x1c, 0xd3, 0xda, 0x94, 0xa4, 0x10, 0x6c, 0xcc, 0x80, 0x30, 0x29, 0xfa,
+  0x1a, 0x0d, 0x3e, 0x8f, 0x6e, 0xc4, 0xfc, 0xb4, 0xc0, 0xaa, 0x27, 0x2a, 0x2e, 0x85, 0x97, 0x40,
+  0x0c, 0xd4, 0x68, 0xc3, 0x4e, 0xc9, 0xc7, 0x9f, 0xf1, 0x50, 0x7c, 0x2f, 0x92, 0x8e, 0xd5, 0xd2,
+  0x24, 0xed, 0xd4, 0xfa, 0x62, 0x05, 0xd1, 0x75, 0x6e, 0xad, 0x61, 0x4d, 0xe2, 0xb4, 0x8a, 0x63,
+  0xc3, 0xf8, 0xf2, 0x02, 0x94, 0xf5, 0x27, 0x37, 0xbf, 0x96, 0xab, 0x40, 0x79, 0xc0, 0xed, 0xd8,
+  0xe1, 0x59, 0xea, 0x2f, 0x26, 0xe0, 0xb1, 0xef, 0x60, 0x92, 0xf5, 0x5a, 0x5f, 0x46, 0x8f, 0x15,
+  0xa0, 0xd4, 0xcc, 0x2d, 0xd8, 0x33, 0xda, 0xc4, 0x73, 0xd4, 0x45, 0x58, 0x92, 0x20, 0x5c, 0xe9,
+  0xf0, 0xa5, 0x54, 0x77, 0xe6, 0x3c, 0x2f, 0xee, 0x12, 0x1f, 0x5c, 0x1b, 0xe9, 0xd9, 0x4c, 0x26,
+  0xe0, 0x2f, 0xca, 0xde, 0xee, 0x84, 0x2e, 0x0d, 0xc0, 0xa5, 0xbc, 0x83, 0xa3, 0xab, 0xc7, 0xdc,
+  0x24, 0xa0, 0xed, 0x4c, 0x51, 0x24, 0x8b, 0x45, 0xba, 0x4e, 0x6a, 0x5e, 0x2b, 0x7c, 0xe6, 0xb2,
+  0xb0, 0xf9, 0x1d, 0x9a, 0xbd, 0xe9, 0x10, 0x5a, 0x45, 0xc8, 0xb3, 0x4a, 0xe8, 0xe4, 0x67, 0x6e,
+  0x96, 0xc5, 0x77, 0xcf, 0x93, 0x22, 0x72, 0x30, 0xcd, 0x07, 0x0e, 0x1b, 0xcf, 0x7b, 0xb4, 0x33,
+  0xdd, 0xca, 0x15, 0x95, 0x06, 0x0c, 0xfd, 0x46, 0xc2, 0xdc, 0xa1, 0x18, 0xb5, 0xd3, 0xeb, 0x40,
+  0xf4, 0x09, 0x3f, 0x29, 0xae, 0x84, 0xdf, 0x22, 0x62, 0x84, 0x0f, 0x18, 0x0b, 0xc2, 0x2f, 0x19,
+  0xe5, 0xc1, 0x27, 0x8c, 0xdf, 0xe0, 0x17, 0x45, 0x66, 0x4a, 0xd9, 0xe5, 0x56, 0xd6, 0x9b, 0xa3,
+  0x48, 0x5d, 0x25, 0xc8, 0xe7, 0x4e, 0xe7, 0xd4, 0x98, 0x1d, 0x4f, 0x29, 0x0e, 0xed, 0x10, 0xd7,
+  0xc1, 0xc1, 0x3e, 0xa1, 0x4d, 0xef, 0x81, 0x83, 0xb5, 0x54, 0x1f, 0x45, 0x32, 0x4c, 0x7d, 0xab,
+  0xd2, 0x5d, 0xaa, 0x21, 0x9c, 0x4f, 0x70, 0x5f, 0x7b, 0xcc, 0xab, 0x3e, 0x50, 0xb8, 0xf8, 0xc3,
+  0x5c, 0x41, 0x88, 0xef, 0x2f, 0xe4, 0x77, 0x76, 0x6f, 0xce, 0x1f, 0xc6, 0xa0, 0xf6, 0x30, 0xbf,
+  0xd3, 0x65, 0xe7, 0x17, 0x15, 0x67, 0x20, 0x02, 0x0b, 0x99, 0xf3, 0x98, 0x88, 0x1e, 0xc4, 0x3c,
+  0x99, 0x97, 0x8b, 0x2e, 0xec, 0x72, 0xb9, 0xca, 0xab, 0x14, 0xbd, 0x76, 0xfc, 0x1b, 0x07, 0x0f,
+  0x98, 0x65, 0x58, 0x91, 0x34, 0xfe, 0x70, 0x0a, 0x43, 0xb7, 0x32, 0xfa, 0xfa, 0x69, 0xa7, 0x6f,
+  0xa5, 0x9a, 0x8f, 0x78, 0x41, 0xd9, 0xc4, 0x2e, 0x42, 0x0c, 0xd0, 0x22, 0xc1, 0x51, 0x09, 0xdf,
+  0x75, 0x0c, 0x35, 0x24, 0x70, 0x49, 0x07, 0x84, 0xaf, 0xed, 0x70, 0x82, 0x85, 0x3a, 0xa8, 0x68,
+  0x69, 0x87, 0xae, 0x58, 0xac, 0x0f, 0xa8, 0x1a, 0xdb, 0xc7, 0x84, 0x73, 0x1d, 0x38, 0x9c, 0x77,
+  0xd8, 0x6e, 0xb5, 0x1c, 0xb9, 0x1d, 0xec, 0x19, 0xeb, 0xc8, 0x50, 0xbe, 0xc3, 0x26, 0x20, 0x07,
+  0x5d, 0x80, 0xe9, 0xf4, 0x11, 0xb2, 0xc2, 0xd1, 0xca, 0x0e, 0x03, 0xb5, 0xd7, 0x44, 0xfd, 0xe2,
+  0x61, 0xd4, 0x9e, 0x8d, 0x1a, 0x11, 0xaa, 0x6d, 0xc5, 0x1d, 0x1a, 0x90, 0xf3, 0xfc, 0x16, 0xb4,
+  0x11, 0xb6, 0x05, 0x3b, 0x7f, 0x85, 0x10, 0xd2, 0xe9, 0x30, 0x7d, 0xb5, 0x04, 0x07, 0x5a, 0x05,
+  0xc6, 0xf3, 0x12, 0x8c, 0x50, 0xe0, 0x58, 0x5b, 0xfe, 0x11, 0x74, 0xeb, 0x6d, 0x1a, 0x70, 0x87,
+  0xa4, 0xa6, 0x6b, 0xee, 0xb9, 0x50, 0x40, 0x63, 0x38, 0xe2, 0xd3, 0x81, 0x1a, 0x0a, 0x72, 0x2f,
+  0x55, 0x9a, 0xc9, 0x48, 0xc0, 0x89, 0xd8, 0x19, 0x69, 0x70, 0x45, 0xba, 0x29, 0xae, 0xd8, 0x35,
+  0x8d, 0x66, 0xec, 0xfc, 0x1c, 0xb0, 0x7c, 0xba, 0x1d, 0x79, 0x1d, 0xf6, 0xe4, 0x09, 0x13, 0xad,
+  0xc0, 0x8a, 0x91, 0xec, 0x99, 0x76, 0xf4, 0x81, 0x4c, 0x68, 0x80, 0xa3, 0x51, 0x02, 0xd8, 0xd8,
+  0xee, 0x39, 0x1b, 0xeb, 0x2d, 0xa4, 0xc2, 0xb0, 0x38, 0x83, 0xc0, 0xcd, 0xa4, 0xd5, 0x13, 0xcf,
+  0xd8, 0x63, 0x9c, 0x74, 0x69, 0x4d, 0xca, 0x04, 0x36, 0x98, 0x46, 0x80, 0xed, 0xee, 0xce, 0x74,
+  0xac, 0xf7, 0x3a, 0x31, 0xe1, 0x56, 0xf4, 0xe7, 0x0a, 0x3d, 0xe0, 0xd0, 0x51, 0xa8, 0x33, 0x21,
+  0x2f, 0x51, 0xd5, 0x70, 0xb6, 0x01, 0x04, 0xde, 0x11, 0xa8, 0xe4, 0x69, 0xa7, 0x3b, 0x08, 0xa3,
+  0x18, 0x62, 0x6c, 0xe7, 0x05, 0x1c, 0x77, 0xdc, 0xd8, 0x06, 0xa9, 0xf9, 0x34, 0xae, 0x85, 0xcf,
+  0x24, 0x08, 0x95, 0x9a, 0x02, 0xe2, 0x4a, 0x13, 0xab, 0xcf, 0x32, 0xa5, 0xaf, 0xbe, 0xd6, 0xd9,
+  0x7b, 0xe3, 0x48, 0x33, 0x91, 0x85, 0xf3, 0x0a, 0xde, 0x9b, 0x1b, 0x47, 0x95, 0x35, 0xa9, 0x52,
+  0xa6, 0x73, 0x66, 0xa9, 0x40, 0x2b, 0x72, 0x14, 0xbc, 0x28, 0x59, 0xf1, 0x4d, 0xac, 0x85, 0x70,
+  0x80, 0x39, 0x35, 0xa3, 0x58, 0x1a, 0x0a, 0x86, 0x35, 0xf7, 0x0a, 0x41, 0xd0, 0xcc, 0x65, 0x78,
+  0xfb, 0xfd, 0x1a, 0x0c, 0x1b, 0xc2, 0xf5, 0xc0, 0x17, 0xec, 0x9a, 0x33, 0x22, 0xf3, 0x12, 0xda,
+  0x93, 0xa1, 0x8d, 0xe4, 0xdf, 0xcc, 0xb8, 0x6f, 0x67, 0xdd, 0x1f, 0x64, 0xde, 0x3d, 0xe3, 0x78,
+  0x5e, 0xd4, 0x2b, 0x1a, 0x75, 0xcd, 0x15, 0xd4, 0xce, 0x8b, 0xfa, 0x67, 0x0d, 0x18, 0x77, 0x8d,
+  0x55, 0x3e, 0x08, 0xff, 0xb4, 0x6b, 0x73, 0xe2, 0xc1, 0x21, 0xfb, 0xdd, 0x16, 0x6e, 0x3d, 0x4c,
+  0x18, 0x50, 0xf6, 0xd5, 0x5c, 0x8c, 0x60, 0x80, 0x41, 0xaf, 0x6c, 0xba, 0xdf, 0x8a, 0xa9, 0x49,
+  0x73, 0x0b, 0x2b, 0xed, 0x41, 0xad, 0x54, 0x3f, 0x3c, 0xee, 0xe9, 0x49, 0x4d, 0x76, 0x58, 0xed,
+  0x75, 0x73, 0x77, 0xbf, 0x85, 0xf0, 0x7d, 0x0d, 0x97, 0xd7, 0x8e, 0xeb, 0xc5, 0xb7, 0xe0, 0xba,
+  0x00, 0xb2, 0x86, 0x68, 0x8f, 0x12, 0x76, 0x06, 0x1f, 0x8f, 0x2c, 0x0a, 0x85, 0x73, 0x35, 0x4d,
+  0x58, 0x1f, 0xc0, 0x66, 0x7f, 0x80, 0x56, 0xc0, 0x7f, 0x52, 0xe3, 0x3f, 0xd9, 0x82, 0xff, 0xa4,
+  0x15, 0xbf, 0x08, 0x21, 0xb6, 0xa1, 0xdf, 0xaf, 0xd1, 0xef, 0x1f, 0x59, 0x4c, 0xd1, 0xd0, 0xef,
+  0xdb, 0xe8, 0xbf, 0x95, 0x3d, 0x10, 0x60, 0x56, 0x13, 0x8c, 0x86, 0x5b, 0x66, 0x00, 0xc0, 0xb6,
+  0x29, 0x9a, 0x2b, 0xa8, 0x3f, 0x4b, 0x1d, 0xd5, 0x0d, 0x8d, 0x38, 0x47, 0xdb, 0x0f, 0x16, 0x35,
+  0xf0, 0xfe, 0x51, 0xcb, 0xd1, 0x77, 0xff, 0x48, 0x79, 0xef, 0x2f, 0xa2, 0xc4, 0x85, 0xd0, 0x26,
+  0xcc, 0xc9, 0x3b, 0x77, 0xc0, 0x75, 0x0f, 0xa3, 0xf9, 0x64, 0xb2, 0x2e, 0x44, 0x07, 0xf8, 0xed,
+  0x53, 0x08, 0x18, 0x0b, 0xf0, 0xb2, 0x7f, 0x1b, 0xde, 0x1e, 0x0f, 0x59, 0x19, 0x01, 0x5c, 0xe9,
+  0x2e, 0xb3, 0x62, 0x86, 0x0e, 0xbc, 0x88, 0x07, 0xf2, 0x00, 0xc2, 0xf4, 0x50, 0xa1, 0x9c, 0x86,
+  0xb1, 0x3b, 0x2f, 0x66, 0xd3, 0x1b, 0x17, 0xc2, 0xf9, 0x92, 0xc1, 0x99, 0x14, 0xf0, 0xb8, 0x74,
+  0xab, 0x06, 0x38, 0x69, 0x66, 0x53, 0x2a, 0x29, 0x82, 0x68, 0xa0, 0xe4, 0x05, 0x30, 0x82, 0x46,
+  0xc0, 0xfa, 0x63, 0x88, 0x4e, 0x63, 0xe6, 0x78, 0x11, 0x0c, 0x1a, 0xf6, 0xc7, 0xdd, 0x9e, 0xc2,
+  0x39, 0xbc, 0x1d, 0x1e, 0x33, 0x5e, 0x64, 0x9f, 0xb1, 0x2c, 0x01, 0x95, 0xa8, 0x07, 0x4d, 0xa3,
+  0x21, 0xa6, 0xb0, 0xe6, 0x10, 0x1d, 0x41, 0x0c, 0x00, 0x54, 0x70, 0x36, 0xc2, 0x66, 0xd8, 0xe4,
+  0xd7, 0x2f, 0x7f, 0x10, 0xdc, 0x06, 0x16, 0xe7, 0x11, 0xc6, 0x52, 0x1a, 0x26, 0x58, 0x85, 0x2f,
+  0x22, 0x14, 0xcc, 0x81, 0x47, 0x3e, 0xe1, 0x1a, 0x0f, 0x65, 0x8c, 0x44, 0x51, 0xd0, 0x40, 0x45,
+  0x35, 0x15, 0x63, 0x28, 0xce, 0x03, 0x7c, 0x9e, 0x60, 0x8b, 0xc2, 0x06, 0xac, 0x80, 0xb3, 0x64,
+  0x1d, 0xc1, 0x39, 0x0d, 0xf4, 0x04, 0x55, 0x5c, 0x23, 0x83, 0x18, 0x70, 0xee, 0xe7, 0x51, 0x39,
+  0xd0, 0x56, 0x31, 0x96, 0x18, 0x81, 0xaf, 0x8b, 0x20, 0xaf, 0x78, 0x92, 0xbb, 0x6b, 0xc1, 0x97,
+  0x37, 0xff, 0x64, 0x5e, 0x9c, 0x42, 0x00, 0x0c, 0xe7, 0x13, 0xa5, 0x40, 0x04, 0x7b, 0x67, 0x18,
+  0x8b, 0x71, 0x76, 0xfd, 0xe6, 0xcb, 0x4b, 0x08, 0xba, 0x31, 0x07, 0x62, 0x05, 0x5b, 0x03, 0x3f,
+  0xcb, 0xb4, 0x78, 0xef, 0xcd, 0x3f, 0x3f, 0xbf, 0x7c, 0x7d, 0xf9, 0x51, 0xa6, 0x0a, 0xd0, 0x5d,
+  0x7b, 0x95, 0xa0, 0x5f, 0x90, 0x3b, 0xdd, 0x01, 0xa7, 0x4f, 0x8e, 0x94, 0x8b, 0xce, 0x2b, 0xe6,
+  0xfc, 0xcc, 0x9c, 0xd7, 0xcc, 0x79, 0xc9, 0x9c, 0x7f, 0x60, 0x6c, 0xb0, 0x8e, 0xc2, 0x68, 0xd2,
+  0x65, 0xd9, 0xe2, 0xee, 0x33, 0x16, 0x6f, 0x4d, 0x18, 0x38, 0xa5, 0xd9, 0xea, 0x33, 0x2d, 0x15,
+  0xbf, 0x2c, 0xb8, 0x9b, 0x55, 0x3d, 0xc5, 0x5d, 0x51, 0xf2, 0xe5, 0x67, 0x37, 0x8b, 0xc0, 0x19,
+  0x65, 0xbb, 0x0a, 0x69, 0x97, 0x36, 0x2b, 0xe1, 0x65, 0x14, 0x7e, 0x06, 0x56, 0x04, 0x31, 0xc8,
+  0x10, 0xde, 0x06, 0xb9, 0x2c, 0xca, 0x26, 0xac, 0x07, 0x4c, 0x2e, 0xae, 0xf1, 0xf7, 0x7c, 0x8d,
+  0x48, 0x7e, 0xfc, 0xf8, 0xf1, 0xfd, 0xe7, 0xcb, 0x37, 0xaf, 0x5f, 0xbd, 0xfd, 0x48, 0x13, 0x94,
+  0x65, 0x16, 0xe0, 0x07, 0x90, 0x06, 0x2c, 0x1b, 0xd2, 0xf0, 0xfa, 0x55, 0xd0, 0x1c, 0x44, 0x45,
+  0xfd, 0x05, 0x9c, 0xd2, 0x42, 0x5c, 0x37, 0x81, 0x42, 0x4d, 0x58, 0xff, 0x02, 0x94, 0x35, 0xc2,
+  0xbb, 0x0f, 0x9e, 0xe7, 0xb0, 0x69, 0x28, 0xb4, 0xe9, 0xaa, 0x64, 0x3f, 0x40, 0x94, 0x47, 0xe4,
+  0x1b, 0x38, 0xa7, 0x16, 0x2b, 0x67, 0xac, 0xb8, 0x26, 0x99, 0x61, 0x42, 0x3e, 0x95, 0x63, 0x5c,
+  0x85, 0x9b, 0xf1, 0x97, 0x97, 0x9c, 0x58, 0xe8, 0x41, 0xc8, 0xd6, 0xc3, 0xbd, 0x7b, 0xc3, 0x13,
+  0x3b, 0xd4, 0xc4, 0x83, 0x46, 0xee, 0x82, 0xf4, 0xad, 0xcc, 0x60, 0x0c, 0xe9, 0x69, 0x24, 0x72,
+  0x02, 0xf0, 0x5d, 0x25, 0xba, 0xaa, 0xae, 0x66, 0x55, 0x0e, 0x0a, 0x5e, 0x3a, 0x12, 0x57, 0x57,
+  0x0f, 0x34, 0x53, 0x0c, 0xc6, 0x4c, 0xb4, 0xb0, 0xd3, 0x30, 0x1a, 0x83, 0xbc, 0x44, 0x44, 0x79,
+  0xc2, 0x9d, 0x3d, 0x85, 0xa0, 0x0d, 0x2f, 0xbc, 0xa1, 0xc3, 0x13, 0x86, 0x02, 0x8c, 0x14, 0x18,
+  0x0e, 0xac, 0xbc, 0x50, 0x7e, 0xad, 0x2f, 0x0e, 0xac, 0x83, 0x03, 0x34, 0x61, 0xe8, 0x85, 0x7a,
+  0xca, 0x29, 0x3c, 0x95, 0xf1, 0x20, 0x4b, 0x4e, 0xeb, 0x98, 0x52, 0xf3, 0x86, 0xbd, 0x16, 0xef,
+  0x51, 0xe5, 0x2b, 0xaf, 0x89, 0x1a, 0xcf, 0xb2, 0x4e, 0x22, 0xad, 0x84, 0x1c, 0x10, 0x10, 0x17,
+  0x17, 0x6c, 0xdf, 0x0c, 0x5b, 0xa8, 0x17, 0x3d, 0x91, 0x83, 0xae, 0x84, 0x14, 0x4b, 0xc3, 0x0e,
+  0xcd, 0x11, 0x53, 0xec, 0xf1, 0x06, 0xc5, 0xca, 0x73, 0x89, 0x89, 0xb0, 0x25, 0x18, 0x03, 0x20,
+  0x5c, 0x8f, 0xa5, 0x7a, 0x34, 0x84, 0x2b, 0x86, 0x66, 0x6d, 0x74, 0xa3, 0x45, 0x78, 0xe0, 0x60,
+  0xca, 0xeb, 0x35, 0x79, 0x20, 0x5d, 0xd7, 0x76, 0x54, 0x9b, 0x86, 0xa1, 0x58, 0xd6, 0x8c, 0xfd,
+  0x06, 0x06, 0x4b, 0x45, 0x1d, 0x67, 0x67, 0xec, 0xd8, 0x9e, 0x71, 0x6c, 0x2e, 0x7b, 0x59, 0x2d,
+  0xfa, 0x09, 0x2c, 0xce, 0x9c, 0x79, 0x59, 0x2d, 0x79, 0x59, 0x2f, 0x78, 0xa9, 0x21, 0x5c, 0x22,
+  0x42, 0x8b, 0x53, 0x44, 0x0a, 0x7a, 0xa1, 0x98, 0xe2, 0xc4, 0x2f, 0x17, 0xb0, 0x2e, 0xfc, 0x08,
+  0x24, 0x2d, 0xf1, 0xcb, 0xaa, 0xdc, 0xb4, 0x16, 0x72, 0x8a, 0x91, 0x28, 0x34, 0xbe, 0x29, 0x9c,
+  0x4b, 0x29, 0x96, 0x41, 0xe0, 0xa0, 0x21, 0xfc, 0xea, 0xf7, 0xbb, 0x38, 0x78, 0x9a, 0xc2, 0xd6,
+  0x61, 0x3f, 0x7c, 0x2c, 0xb4, 0x5d, 0x54, 0x27, 0x8b, 0x94, 0x0d, 0xda, 0x09, 0xb5, 0x07, 0x41,
+  0xcd, 0xf9, 0x7b, 0xcd, 0x2c, 0x81, 0xd5, 0x3f, 0xd6, 0x6c, 0x92, 0x50, 0xa3, 0x1c, 0x42, 0x6e,
+  0x3c, 0x0d, 0xcc, 0x7c, 0x31, 0x1d, 0x05, 0x97, 0x64, 0xc3, 0x55, 0xce, 0xf5, 0xe9, 0x88, 0x7e,
+  0x3e, 0xa5, 0x9f, 0x63, 0xfc, 0x49, 0xff, 0x67, 0x96, 0x7a, 0x96, 0xeb, 0x14, 0x85, 0xff, 0x6b,
+  0x25, 0xb4, 0x20, 0xa1, 0x70, 0x54, 0x40, 0xe0, 0x3c, 0xc4, 0x30, 0x39, 0xa1, 0xb0, 0x19, 0x3f,
+  0x54, 0x57, 0xe7, 0x6a, 0x24, 0x5e, 0x19, 0xb8, 0xe5, 0xc7, 0xc2, 0x59, 0x16, 0xb6, 0x3a, 0x17,
+  0x1c, 0x75, 0xe7, 0x27, 0xb7, 0x5c, 0x0c, 0xc2, 0x38, 0x4d, 0x73, 0x00, 0x61, 0x7b, 0x94, 0x50,
+  0xee, 0x5a, 0x49, 0x96, 0xdc, 0x45, 0x48, 0xe8, 0xfe, 0x2b, 0x75, 0x9f, 0x9a, 0x5c, 0x82, 0x90,
+  0x14, 0xa6, 0x46, 0x12, 0x35, 0x5c, 0x88, 0x7c, 0x8f, 0x3d, 0x3d, 0x04, 0x64, 0x62, 0x14, 0x05,
+  0xf5, 0x93, 0x8d, 0x90, 0x87, 0x04, 0x77, 0x58, 0x83, 0x55, 0x1b, 0x8a, 0xe0, 0x08, 0x53, 0xf5,
+  0x0e, 0x28, 0x87, 0x40, 0x44, 0x55, 0x5c, 0x18, 0x62, 0xe6, 0xa0, 0x6a, 0x52, 0x9c, 0x51, 0xc9,
+  0x04, 0xea, 0x80, 0x91, 0x33, 0xd6, 0xd1, 0x37, 0xb0, 0x62, 0x52, 0x40, 0x9b, 0x26, 0xdc, 0x03,
+  0xc7, 0x5b, 0x85, 0x3d, 0x38, 0xec, 0x6a, 0x6e, 0xa1, 0x30, 0x79, 0x4d, 0xc3, 0x26, 0xe1, 0x60,
+  0xaa, 0x31, 0x4c, 0x64, 0xf3, 0x4c, 0xa5, 0xcb, 0xeb, 0x24, 0x91, 0x68, 0x97, 0x9e, 0x07, 0xab,
+  0xb5, 0x11, 0x10, 0x80, 0xb2, 0x0d, 0x67, 0xa0, 0x3b, 0x70, 0x98, 0x86, 0x5d, 0xa6, 0xdd, 0xad,
+  0xa3, 0x2e, 0xa8, 0x11, 0x18, 0x88, 0x8f, 0xd0, 0x8e, 0xe9, 0x0d, 0x63, 0x95, 0xd7, 0x12, 0x13,
+  0x5a, 0xc9, 0xb9, 0x45, 0xba, 0xfe, 0x88, 0x44, 0xd4, 0xf8, 0x8f, 0x81, 0x85, 0x38, 0x6e, 0x68,
+  0x67, 0xfb, 0x46, 0x7a, 0x03, 0xc5, 0xdc, 0x43, 0x8b, 0x70, 0x71, 0xaa, 0x37, 0x53, 0x6d, 0x38,
+  0xe0, 0x06, 0xe1, 0xe1, 0x3c, 0x5f, 0x44, 0x61, 0x29, 0x3e, 0xfa, 0xb5, 0x46, 0x36, 0xcc, 0xf4,
+  0x0d, 0x6a, 0x3c, 0xd8, 0x66, 0x24, 0xe8, 0x08, 0x16, 0xfc, 0xbd, 0x10, 0xc2, 0x2c, 0x5d, 0x3b,
+  0x63, 0x89, 0x04, 0xec, 0xb3, 0x40, 0x06, 0x90, 0x47, 0x9a, 0x41, 0x97, 0xa3, 0x70, 0x19, 0x0d,
+  0x8b, 0x5e, 0x4d, 0x28, 0x39, 0x72, 0xa3, 0x65, 0x62, 0x9a, 0xec, 0x94, 0x11, 0x9e, 0x6d, 0xdd,
+  0xc5, 0x51, 0x05, 0xc4, 0x8a, 0xf5, 0xea, 0x89, 0x15, 0x94, 0x81, 0xf6, 0x73, 0x52, 0xb7, 0x8e,
+  0x1a, 0xe3, 0xee, 0x7f, 0xcf, 0xb1, 0xa2, 0xfc, 0x45, 0xfb, 0x58, 0xa1, 0xbd, 0x70, 0xe0, 0xe7,
+  0x6e, 0x45, 0x12, 0x6a, 0xca, 0xfe, 0xf8, 0x64, 0xff, 0xe4, 0xf0, 0x68, 0x7c, 0x72, 0x68, 0x9b,
+  0xf1, 0x78, 0x03, 0xf9, 0xb4, 0xb1, 0xe8, 0xf2, 0x9d, 0x93, 0xcd, 0x1a, 0x04, 0x72, 0x21, 0xcd,
+  0x53, 0x06, 0x56, 0xd4, 0x38, 0x62, 0x78, 0x62, 0x5a, 0x68, 0x41, 0xee, 0x13, 0x72, 0x33, 0x85,
+  0x61, 0x52, 0xd9, 0xf8, 0xa9, 0xbf, 0x40, 0xd3, 0x8a, 0x53, 0x9d, 0xd6, 0x29, 0x0c, 0xcd, 0xeb,
+  0xd7, 0xf2, 0xd6, 0xca, 0x3f, 0x26, 0xa3, 0x38, 0x55, 0x38, 0x8f, 0xac, 0xc4, 0xaa, 0x36, 0xd9,
+  0xbe, 0xd8, 0x78, 0x1a, 0xdc, 0x55, 0xcb, 0xa1, 0x6c, 0xd9, 0x74, 0x78, 0x8a, 0x76, 0x41, 0xa0,
+  0xdd, 0xc5, 0x9c, 0x12, 0x9a, 0x1a, 0x04, 0xd8, 0x55, 0x00, 0x4b, 0x2d, 0xf5, 0x45, 0xea, 0x22,
+  0xb2, 0x92, 0x3a, 0x7e, 0x14, 0x2c, 0x38, 0x67, 0x1e, 0x0b, 0xd5, 0xe9, 0x82, 0x6e, 0x12, 0x8a,
+  0x49, 0x6d, 0x47, 0x31, 0xbd, 0x22, 0x10, 0x77, 0x37, 0x9c, 0x1a, 0x9a, 0x26, 0xde, 0x5b, 0x59,
+  0x7d, 0x9c, 0x0f, 0x2f, 0x08, 0xc9, 0xf7, 0xee, 0x61, 0xaa, 0xd2, 0x32, 0x35, 0x38, 0x74, 0x5a,
+  0xdf, 0x73, 0x69, 0x57, 0x57, 0x8a, 0xa7, 0x83, 0x9c, 0xd3, 0x45, 0xba, 0xb3, 0xf7, 0x29, 0x7f,
+  0xf6, 0x29, 0xf9, 0x6e, 0x0f, 0xcf, 0x8b, 0xda, 0x85, 0x12, 0xb7, 0x6f, 0x9b, 0x51, 0x90, 0xa6,
+  0x2d, 0xdd, 0x5b, 0x07, 0x74, 0xf4, 0xf2, 0xcd, 0xd5, 0x20, 0xc2, 0xab, 0xa1, 0x77, 0x21, 0xa6,
+  0x54, 0x71, 0xe1, 0x80, 0xca, 0xc4, 0xb5, 0xd8, 0x8c, 0x0a, 0x6c, 0x1f, 0x8c, 0x18, 0xea, 0xe0,
+  0x04, 0x57, 0x27, 0xf2, 0x84, 0xd3, 0xa3, 0x6e, 0xda, 0xce, 0xea, 0xe1, 0xdd, 0xfa, 0x02, 0xae,
+  0x86, 0xa6, 0x58, 0x50, 0xde, 0xc0, 0xd5, 0xad, 0x85, 0xbf, 0xe0, 0xc1, 0x2a, 0xe6, 0x1f, 0xe8,
+  0xee, 0xcb, 0x8a, 0xf6, 0x2a, 0xc6, 0xd2, 0xdd, 0x32, 0x5d, 0xbd, 0x3a, 0x16, 0x37, 0x31, 0x57,
+  0x18, 0x3b, 0x98, 0xa9, 0x08, 0xe1, 0x6b, 0x60, 0xae, 0xce, 0xbc, 0x01, 0x64, 0xc6, 0xfd, 0x5f,
+  0x55, 0xb0, 0xa3, 0xdf, 0xe6, 0xfd, 0x2e, 0xa2, 0x6c, 0xa8, 0x8a, 0x30, 0xe4, 0x8b, 0x71, 0x97,
+  0x67, 0xdf, 0x4e, 0xd8, 0x17, 0x7d, 0xfa, 0xdc, 0x39, 0xff, 0xd7, 0x0a, 0xe2, 0xd5, 0xe7, 0x49,
+  0xb4, 0xa4, 0x22, 0xe2, 0x1f, 0x30, 0xf8, 0x92, 0xe8, 0x1a, 0xb1, 0xf0, 0xf3, 0xb7, 0x57, 0xaf,
+  0x45, 0x04, 0xa7, 0x82, 0x5c, 0x0a, 0x06, 0x57, 0x19, 0x73, 0x21, 0xb6, 0xf4, 0x56, 0x51, 0x5c,
+  0x8a, 0xbb, 0xe9, 0x35, 0x06, 0xbe, 0xae, 0xb8, 0xf6, 0x53, 0x77, 0x91, 0x60, 0x40, 0x52, 0x86,
+  0x4f, 0x62, 0x2c, 0x97, 0x02, 0x18, 0xfa, 0x01, 0x6c, 0x75, 0x9e, 0xae, 0x7b, 0xac, 0x11, 0x24,
+  0xa0, 0x05, 0x34, 0xee, 0x5c, 0xcd, 0x63, 0x44, 0xaa, 0xac, 0x10, 0xf4, 0xa8, 0x52, 0x74, 0xc0,
+  0x65, 0x24, 0xf1, 0x3b, 0x44, 0x08, 0xaa, 0x30, 0x08, 0xe9, 0x54, 0x49, 0x75, 0x34, 0x33, 0x06,
+  0x20, 0xae, 0x4b, 0x51, 0x04, 0x6f, 0x24, 0xb6, 0xe9, 0x8a, 0x80, 0xee, 0xd6, 0xd4, 0x11, 0x7b,
+  0x81, 0xd9, 0x3f, 0xdb, 0xe2, 0xfa, 0x8b, 0xdf, 0x73, 0xf1, 0xb3, 0x30, 0xe9, 0xf3, 0x17, 0x1d,
+  0xa3, 0xd3, 0xa4, 0xc5, 0x51, 0x37, 0x7e, 0x53, 0xa9, 0x44, 0x40, 0x39, 0x2a, 0x4b, 0xf5, 0x8d,
+  0x1c, 0x19, 0xa6, 0xa1, 0xc0, 0xf5, 0xe8, 0xd7, 0x0b, 0xfe, 0xa2, 0x61, 0x5e, 0x04, 0xd5, 0xb0,
+  0xe9, 0x44, 0x38, 0xd9, 0x02, 0xfa, 0xe2, 0xec, 0xfd, 0xf7, 0xa7, 0xa9, 0xf3, 0x29, 0xf8, 0x3a,
+  0xbe, 0x9f, 0x68, 0x3f, 0x3f, 0x0d, 0xe0, 0xd7, 0xd3, 0xfb, 0xee, 0xa7, 0xd9, 0xa7, 0xe2, 0x99,
+  0x33, 0xfd, 0x54, 0x7c, 0xba, 0x9a, 0x7d, 0xdf, 0xdd, 0xeb, 0xea, 0x5c, 0xa2, 0xf1, 0x2d, 0x21,
+  0x4e, 0xf1, 0x3b, 0x38, 0x53, 0x16, 0x26, 0x67, 0xca, 0xa2, 0x63, 0x74, 0x5a, 0xbb, 0x44, 0xce,
+  0x22, 0xcd, 0x3b, 0x85, 0xe0, 0x42, 0x77, 0xca, 0xda, 0xd8, 0x00, 0xd6, 0xb6, 0xee, 0xac, 0xef,
+  0x44, 0x49, 0xf4, 0x04, 0x92, 0xf1, 0xac, 0x66, 0x94, 0x9d, 0x4e, 0xb2, 0x06, 0xb4, 0x18, 0x6d,
+  0x5b, 0x65, 0x73, 0x5b, 0x55, 0xb7, 0x5c, 0xb9, 0xcb, 0xbb, 0x06, 0xbc, 0xa6, 0x6f, 0xb2, 0x30,
+  0xcb, 0x53, 0x8f, 0x6f, 0xe1, 0x62, 0x10, 0xdd, 0xe8, 0x4c, 0x24, 0xf0, 0xa6, 0x06, 0x74, 0x6c,
+  0x08, 0x8b, 0x99, 0x16, 0xeb, 0x8a, 0x57, 0xb1, 0xc1, 0x3d, 0x1a, 0xd3, 0x35, 0x40, 0xb0, 0xa2,
+  0x40, 0xa0, 0x9a, 0xf3, 0xf2, 0x05, 0x96, 0x66, 0xc2, 0xba, 0x2e, 0xe3, 0x08, 0x10, 0x7e, 0xe0,
+  0x3e, 0x38, 0x0c, 0x03, 0xf1, 0x84, 0x83, 0x6a, 0x4b, 0x8e, 0x1b, 0xd8, 0x73, 0xbe, 0x4c, 0x6f,
+  0x78, 0x1b, 0x76, 0x25, 0xa5, 0xaa, 0x9e, 0x6a, 0x40, 0xd5, 0x89, 0x0a, 0xdb, 0xb9, 0x7e, 0x10,
+  0x7c, 0x2f, 0x08, 0xd9, 0x05, 0xc7, 0xf9, 0x7b, 0x2c, 0x57, 0x21, 0x65, 0xc8, 0x6e, 0x0d, 0xfd,
+  0x15, 0x66, 0x57, 0xe7, 0x2b, 0x95, 0x76, 0x0d, 0x84, 0x6d, 0xfa, 0x98, 0x66, 0x68, 0x44, 0xb4,
+  0x96, 0x1f, 0x69, 0x1e, 0x4b, 0x12, 0x10, 0x91, 0x34, 0xe9, 0x3a, 0x26, 0xb0, 0x8b, 0x54, 0xa1,
+  0x57, 0xd5, 0xe3, 0x54, 0x55, 0x18, 0x51, 0x81, 0x79, 0x17, 0xda, 0xea, 0x28, 0x11, 0x05, 0x6b,
+  0xd2, 0x7b, 0xc3, 0x34, 0x3b, 0xdd, 0xec, 0x63, 0x21, 0x03, 0xc6, 0x94, 0x5b, 0xe8, 0xd2, 0xcf,
+  0x58, 0xbb, 0xb7, 0x5f, 0x9d, 0x31, 0x82, 0x0b, 0x0d, 0xfe, 0x19, 0x47, 0x90, 0xa1, 0xf9, 0x9e,
+  0x5b, 0x70, 0x69, 0x3a, 0xc5, 0x79, 0xdc, 0xaf, 0x0f, 0x31, 0x2b, 0x60, 0x8b, 0xf2, 0xa2, 0xb4,
+  0x08, 0xd1, 0x22, 0x2e, 0xa7, 0x49, 0x14, 0xed, 0xc2, 0x9e, 0xa0, 0x08, 0xbe, 0xaa, 0x7a, 0x21,
+  0x3b, 0xa8, 0x71, 0x35, 0xb4, 0x51, 0x52, 0x6f, 0x69, 0x4f, 0x4e, 0xb9, 0x2b, 0xfa, 0x7c, 0x1e,
+  0xc5, 0x72, 0x12, 0x9f, 0x44, 0x4b, 0xec, 0x4e, 0x35, 0x81, 0xd8, 0xf9, 0xc6, 0x24, 0xd2, 0x4f,
+  0xc6, 0x22, 0x16, 0x65, 0xb8, 0xcf, 0xc4, 0x9c, 0x7d, 0x81, 0xbf, 0xc5, 0x5d, 0xa7, 0xa3, 0xf9,
+  0x1b, 0x95, 0x0c, 0x8d, 0x4b, 0xa2, 0x95, 0xc1, 0x6c, 0xd0, 0x1a, 0x68, 0xd2, 0x35, 0x13, 0xa9,
+  0x21, 0x3f, 0x51, 0x6f, 0xbf, 0x7f, 0x64, 0x0c, 0x17, 0xb2, 0x5e, 0xbd, 0x9f, 0x22, 0x33, 0x88,
+  0x5f, 0x62, 0xa0, 0xe6, 0xbf, 0x1c, 0x8a, 0x57, 0xb1, 0x2c, 0x6b, 0x57, 0xb2, 0xe9, 0xfb, 0x8a,
+  0x0f, 0x20, 0xf6, 0xdd, 0x4e, 0xed, 0x6a, 0xc8, 0xd4, 0xc5, 0xb5, 0x28, 0x40, 0xba, 0x86, 0xe5,
+  0x6b, 0xcc, 0x80, 0x86, 0xdd, 0xdd, 0x4d, 0x2c, 0x40, 0xb8, 0xe9, 0xb5, 0xe5, 0x38, 0xab, 0x4d,
+  0xb9, 0xc6, 0xec, 0x0f, 0x32, 0xd2, 0xbc, 0xd4, 0x43, 0x7e, 0x2c, 0xa2, 0x20, 0xa0, 0x80, 0xc1,
+  0xbe, 0x75, 0x6a, 0x5e, 0x3e, 0xda, 0x1e, 0x3c, 0x05, 0xb1, 0x28, 0x93, 0xbb, 0xd5, 0xee, 0x5f,
+  0x9b, 0xf3, 0x0b, 0x86, 0x63, 0xbc, 0x99, 0x34, 0x67, 0xc6, 0xe1, 0x89, 0x3e, 0xa3, 0xe5, 0x57,
+  0xb4, 0x4d, 0x6c, 0x50, 0x6c, 0x98, 0x62, 0xc3, 0x9c, 0x0b, 0xd1, 0x73, 0x83, 0xe0, 0x15, 0x66,
+  0x5b, 0xdf, 0x44, 0x05, 0xd8, 0x4b, 0xcc, 0xc9, 0x08, 0x89, 0xef, 0xf4, 0xac, 0x18, 0xb6, 0x72,
+  0xf1, 0x6c, 0xbd, 0xd8, 0x65, 0x2d, 0x42, 0x7c, 0xd1, 0x66, 0x78, 0x40, 0x42, 0x71, 0x4b, 0x1f,
+  0xf0, 0x0f, 0xe5, 0x6f, 0x59, 0xcd, 0xd7, 0xa4, 0x0f, 0x82, 0xa8, 0xe8, 0x0b, 0x07, 0xfa, 0xcc,
+  0xf1, 0xdd, 0xd3, 0xc6, 0x29, 0x15, 0x02, 0xe8, 0xe2, 0x8a, 0x4a, 0x44, 0x2d, 0xbf, 0x52, 0xab,
+  0xc2, 0xd2, 0x79, 0xae, 0x4a, 0x4e, 0xc5, 0x19, 0x83, 0x53, 0x4a, 0x5b, 0xee, 0x50, 0xc1, 0x9f,
+  0x5e, 0x28, 0xd1, 0x84, 0x14, 0xd5, 0x97, 0x0e, 0xd6, 0x04, 0xf6, 0xea, 0x02, 0xb0, 0x6f, 0x1b,
+  0x23, 0x8b, 0x2e, 0x7b, 0xec, 0x71, 0xdb, 0x40, 0xe1, 0x09, 0xab, 0x76, 0x43, 0x46, 0x2a, 0x9c,
+  0xb6, 0x03, 0x51, 0xe7, 0xc8, 0x7f, 0xab, 0x89, 0x99, 0x69, 0x27, 0x61, 0xdb, 0xb5, 0x92, 0xb4,
+  0x5f, 0x58, 0xd9, 0x7d, 0x6e, 0x54, 0x8d, 0x0e, 0xa8, 0x6e, 0x1b, 0x90, 0x3d, 0x63, 0x1d, 0x8f,
+  0x8a, 0xcf, 0x80, 0x5a, 0xcc, 0x1c, 0xc9, 0x8c, 0xb9, 0x51, 0x2e, 0xb1, 0x81, 0xa6, 0x5f, 0x0c,
+  0x9a, 0xe4, 0x9b, 0x5a, 0xe7, 0xbb, 0xaf, 0xcd, 0xa2, 0xb7, 0x7b, 0xf6, 0xdd, 0x57, 0xa2, 0xe2,
+  0xbe, 0x3b, 0xfb, 0xa5, 0xe5, 0x66, 0xcb, 0xa6, 0x7c, 0xcb, 0xb6, 0xd1, 0x66, 0x74, 0xcc, 0x9a,
+  0xd6, 0x0d, 0x43, 0x40, 0xd2, 0x36, 0x6f, 0xb3, 0xcd, 0x5e, 0xfd, 0x16, 0xa2, 0xe6, 0xea, 0x26,
+  0x77, 0x89, 0x04, 0x11, 0x87, 0x83, 0x2e, 0xe8, 0xa2, 0xa8, 0x0a, 0x82, 0x07, 0xd5, 0x9b, 0x0d,
+  0x4b, 0x61, 0xab, 0xb2, 0x5f, 0x1d, 0xe2, 0xb1, 0x26, 0xbd, 0x4d, 0x40, 0x93, 0xd2, 0xba, 0x10,
+  0x11, 0x76, 0x8e, 0xb8, 0x4b, 0xdb, 0xf6, 0x81, 0x12, 0x11, 0x1d, 0x23, 0x10, 0xaa, 0x88, 0x69,
+  0xaa, 0x1c, 0xa8, 0x36, 0xd6, 0xcc, 0x59, 0x16, 0x41, 0x0f, 0x27, 0xab, 0x23, 0xb0, 0x2e, 0x98,
+  0xac, 0x1e, 0x8f, 0xd4, 0x15, 0x8b, 0xea, 0xc0, 0xd2, 0x22, 0xc7, 0x6d, 0x25, 0x8f, 0xcc, 0xd6,
+  0xe1, 0xda, 0x42, 0x3c, 0x32, 0x17, 0xfd, 0xcd, 0x24, 0x0b, 0x9b, 0xcc, 0xd7, 0x1f, 0xb4, 0x02,
+  0xcd, 0x5a, 0xe7, 0x74, 0xdf, 0xca, 0x00, 0x7a, 0xf2, 0x44, 0xd7, 0x4c, 0xab, 0x26, 0xa9, 0x55,
+  0x51, 0x60, 0x44, 0xcb, 0xca, 0x4d, 0xe5, 0xad, 0x12, 0x1d, 0xbf, 0x34, 0xaf, 0xa2, 0x28, 0x81,
+  0x71, 0x87, 0x73, 0x7f, 0xf7, 0xb5, 0x05, 0xd1, 0x3d, 0x53, 0x6a, 0xc8, 0x20, 0x64, 0x2d, 0xdc,
+  0x39, 0x2f, 0x7e, 0x91, 0xd5, 0xc9, 0x46, 0xb5, 0x8a, 0x31, 0x14, 0x8e, 0xce, 0x57, 0x2e, 0x84,
+  0x42, 0xce, 0x54, 0xdc, 0xa4, 0xfa, 0x8b, 0x19, 0x71, 0xa7, 0xa2, 0x43, 0x34, 0x63, 0x76, 0x1d,
+  0x02, 0x9e, 0xcd, 0x78, 0x9a, 0xbb, 0xf8, 0xf0, 0x4e, 0x1a, 0xee, 0x66, 0x0b, 0xe8, 0x85, 0x5d,
+  0x4c, 0xb3, 0x8d, 0x39, 0xea, 0x9e, 0xae, 0xdd, 0x78, 0x28, 0x86, 0x18, 0x8f, 0x4b, 0x5a, 0xb9,
+  0xf3, 0x20, 0xc9, 0x8d, 0xdc, 0x55, 0x2d, 0x35, 0xba, 0x7c, 0x98, 0xa1, 0x4e, 0x9b, 0x9c, 0x34,
+  0xf5, 0x42, 0x42, 0xb7, 0x09, 0x8f, 0xc5, 0x88, 0x7f, 0x1b, 0xeb, 0xbf, 0x3e, 0x34, 0xa4, 0x65,
+  0xaa, 0x6d, 0xcc, 0x68, 0xd1, 0x4d, 0xd6, 0xb4, 0x76, 0x96, 0xd2, 0x1a, 0x0b, 0x6e, 0xd1, 0x5b,
+  0x7a, 0x66, 0xdf, 0x50, 0xdc, 0xcd, 0x9c, 0xfd, 0x46, 0x2e, 0xb6, 0xac, 0x77, 0xf7, 0x81, 0x05,
+  0x7f, 0x03, 0xeb, 0xff, 0xad, 0x8c, 0xdd, 0xc8, 0xd2, 0x7b, 0x93, 0x83, 0xe2, 0x81, 0xcb, 0x00,
+  0x94, 0x81, 0x1e, 0xff, 0x60, 0xd8, 0x48, 0x17, 0xe6, 0x06, 0xc3, 0xa8, 0x65, 0x90, 0xe5, 0xf4,
+  0xfb, 0x25, 0x0f, 0xdd, 0x55, 0xac, 0x25, 0xba, 0x55, 0x76, 0x79, 0xb9, 0xc4, 0xb4, 0xd7, 0xb9,
+  0x7a, 0x02, 0x33, 0xb8, 0x71, 0xe3, 0x15, 0xba, 0xe8, 0xd1, 0xd2, 0x31, 0x52, 0x20, 0x8f, 0x25,
+  0xa8, 0x62, 0x02, 0x66, 0x7f, 0xd7, 0x94, 0x0b, 0x5d, 0x17, 0x03, 0x0c, 0x06, 0xef, 0xae, 0xa8,
+  0xc6, 0x19, 0xbd, 0x58, 0x50, 0xd4, 0xab, 0x14, 0x36, 0xa0, 0x1c, 0xbc, 0x7b, 0xff, 0xea, 0xad,
+  0x9d, 0xb4, 0x03, 0xf8, 0x02, 0xfc, 0x35, 0x47, 0x22, 0xac, 0x66, 0x91, 0xcf, 0x44, 0x06, 0xab,
+  0x84, 0xae, 0x34, 0x5a, 0xfb, 0xed, 0x0a, 0x7d, 0x66, 0xd2, 0x6d, 0xa6, 0xb7, 0x64, 0x4f, 0x08,
+  0x51, 0x4f, 0x2d, 0x84, 0x92, 0x83, 0xaa, 0xb3, 0x29, 0x7e, 0xd7, 0xfc, 0x0e, 0xbc, 0xce, 0x04,
+  0xe5, 0xaf, 0xc9, 0x53, 0x11, 0x29, 0x23, 0x5f, 0x01, 0x4c, 0x14, 0x65, 0x3e, 0xcf, 0xc1, 0xa3,
+  0xfd, 0x7b, 0x66, 0x54, 0x7e, 0x6e, 0x67, 0xbd, 0x40, 0xa3, 0x96, 0x5b, 0xd7, 0x7a, 0xd6, 0x0b,
+  0xdc, 0x65, 0x23, 0x88, 0x69, 0x4c, 0x08, 0x53, 0x98, 0x2b, 0x58, 0xb3, 0x1c, 0xd4, 0xe6, 0x86,
+  0x44, 0x31, 0xad, 0xc0, 0x8d, 0xfa, 0xd3, 0x82, 0x97, 0x1f, 0x45, 0x7d, 0x84, 0x23, 0x74, 0x4d,
+  0x0d, 0x87, 0x8e, 0x2b, 0x7a, 0x4c, 0x09, 0xce, 0xcb, 0x07, 0xd4, 0x46, 0xc7, 0x14, 0x0f, 0x41,
+  0x51, 0x8f, 0xb5, 0xb5, 0x76, 0x7b, 0x6c, 0xd8, 0xdd, 0xe8, 0xb2, 0x6d, 0x62, 0xe0, 0x4b, 0x64,
+  0xf9, 0x1f, 0x61, 0xa1, 0x60, 0x58, 0xe3, 0xec, 0xa8, 0xba, 0xfa, 0xfd, 0x3f, 0xca, 0x9f, 0x16,
+  0xcd, 0x6e, 0x17, 0xc1, 0xed, 0x62, 0x68, 0x9b, 0xcd, 0x4a, 0x89, 0x5b, 0x55, 0xbd, 0xc5, 0x76,
+  0xaa, 0x1c, 0xf5, 0x47, 0x7c, 0x14, 0xb3, 0xc2, 0x82, 0x9a, 0x00, 0xac, 0xc9, 0x9c, 0x63, 0x16,
+  0xa6, 0xe0, 0xf9, 0x0d, 0x7c, 0x9d, 0x7f, 0x89, 0xb2, 0x8e, 0x28, 0x41, 0xf2, 0x5d, 0x8c, 0x89,
+  0x20, 0x34, 0x4a, 0x59, 0x24, 0x5e, 0xaf, 0x44, 0x70, 0x0e, 0x26, 0x69, 0x55, 0xb6, 0xc4, 0x4b,
+  0x7c, 0x9e, 0x5a, 0x9c, 0xb2, 0x90, 0x63, 0x86, 0xb4, 0x5c, 0xf0, 0x25, 0x9c, 0x64, 0xb7, 0x58,
+  0xb0, 0x01, 0x23, 0x06, 0xec, 0x72, 0x55, 0xe0, 0xbb, 0x9b, 0x8c, 0xce, 0xcf, 0xa2, 0x84, 0x60,
+  0x93, 0xcd, 0xf1, 0x4a, 0x0c, 0xe1, 0xa2, 0xe4, 0x57, 0xf2, 0x39, 0x07, 0x56, 0x55, 0x4c, 0xea,
+  0x06, 0xa2, 0x7c, 0xcc, 0x0a, 0xb2, 0x8c, 0xf7, 0x58, 0x3f, 0x5f, 0x7d, 0x7e, 0xff, 0xfc, 0xe3,
+  0x8f, 0xd5, 0x4d, 0xec, 0xfb, 0x3c, 0x5d, 0x46, 0x05, 0x07, 0xe3, 0x01, 0x47, 0x3a, 0x78, 0xea,
+  0x5d, 0xeb, 0xbe, 0x9c, 0xe8, 0x73, 0xe2, 0xd4, 0xa7, 0xf4, 0xfd, 0x20, 0x73, 0xcb, 0x05, 0x3e,
+  0x24, 0xd1, 0x2e, 0x76, 0xf6, 0x9e, 0xd1, 0xb5, 0xce, 0x9e, 0xa8, 0x84, 0xf7, 0x89, 0x02, 0xd0,
+  0xdb, 0xaf, 0x82, 0x09, 0xe0, 0xe4, 0x26, 0x69, 0x1f, 0xf7, 0x17, 0x3c, 0xde, 0xfb, 0x6e, 0xb5,
+  0x1d, 0x03, 0x2c, 0x5e, 0x73, 0x72, 0x94, 0xf7, 0x1c, 0xff, 0x70, 0xca, 0x33, 0xf8, 0xf5, 0x6b,
+  0x91, 0x26, 0x0e, 0x5e, 0x29, 0x7f, 0x6d, 0x00, 0xfa, 0xe6, 0x35, 0x2e, 0x63, 0x6d, 0x8b, 0xc2,
+  0x6b, 0x9e, 0xc1, 0xba, 0x78, 0xef, 0x9a, 0xa7, 0x87, 0x0d, 0xfa, 0xe2, 0xf5, 0x5b, 0x82, 0xf4,
+  0xa2, 0x64, 0x1b, 0xd8, 0x9b, 0x7f, 0x12, 0x54, 0xfc, 0xc5, 0x2e, 0xd8, 0xa6, 0x1b, 0xf5, 0x41,
+  0x54, 0x88, 0x9b, 0x75, 0x7f, 0xa0, 0xd2, 0xe7, 0xdd, 0x2e, 0x5d, 0x62, 0xab, 0xf7, 0x38, 0x7a,
+  0x8f, 0x26, 0x86, 0xda, 0xca, 0x7c, 0x4a, 0x88, 0xcb, 0x03, 0xf6, 0xbe, 0x71, 0x1d, 0xf2, 0x2e,
+  0xc1, 0x3a, 0x36, 0xf9, 0x5c, 0x50, 0x7b, 0x16, 0x74, 0x2a, 0x2b, 0xdc, 0xd2, 0xc8, 0x27, 0xf1,
+  0xbb, 0xe6, 0x59, 0x29, 0xa4, 0x0e, 0xcf, 0x6c, 0x4a, 0x07, 0x96, 0xf5, 0x33, 0xa1, 0xc2, 0xba,
+  0xe6, 0xd1, 0x29, 0xa4, 0x27, 0x41, 0x5a, 0x18, 0x54, 0xbf, 0xfc, 0xa1, 0x1e, 0xf3, 0x94, 0x8a,
+  0x82, 0xaa, 0x63, 0xb0, 0x74, 0x33, 0xc7, 0x49, 0xc0, 0xf4, 0x08, 0x83, 0x55, 0xd5, 0xb8, 0x47,
+  0xf8, 0x95, 0x40, 0x54, 0x35, 0x3e, 0x96, 0xba, 0x1a, 0x35, 0x53, 0x85, 0x7b, 0x43, 0x47, 0xb1,
+  0x5e, 0x3b, 0x5d, 0xe6, 0xf8, 0x47, 0xc1, 0x54, 0xcf, 0xdf, 0xae, 0xde, 0xbd, 0x1d, 0x50, 0xf1,
+  0x37, 0xc9, 0x5d, 0x7c, 0x05, 0xc2, 0x03, 0x7a, 0x80, 0x39, 0xe0, 0xd7, 0x25, 0x5f, 0x3a, 0x1d,
+  0x77, 0x5d, 0xb3, 0x16, 0xaf, 0x00, 0xc1, 0x48, 0x10, 0x2b, 0xc1, 0xa8, 0xc1, 0x62, 0xee, 0xb5,
+  0xd5, 0xd0, 0x83, 0x25, 0x73, 0xbf, 0x68, 0x16, 0xbc, 0x2b, 0x85, 0xf5, 0x18, 0x64, 0x53, 0x47,
+  0x75, 0xc5, 0x08, 0x2b, 0xbb, 0xa0, 0xc2, 0xf2, 0x09, 0x02, 0x9a, 0x67, 0xb0, 0x7e, 0x5b, 0xd3,
+  0xb5, 0x1e, 0x46, 0x99, 0x9c, 0x6c, 0x46, 0xac, 0x66, 0xfe, 0x4c, 0xdd, 0x42, 0xa5, 0x21, 0xce,
+  0xd2, 0x4c, 0x97, 0xa9, 0x1c, 0xc0, 0xa6, 0x9c, 0x21, 0xf5, 0xeb, 0xbe, 0x34, 0x35, 0x98, 0xa9,
+  0xf9, 0xfa, 0x51, 0x78, 0xc7, 0xbe, 0x7d, 0xb7, 0xde, 0xa1, 0x5a, 0xc8, 0xc9, 0x9a, 0xea, 0xc8,
+  0xd1, 0xa9, 0xa3, 0x3f, 0x5f, 0x47, 0x57, 0x4a, 0x42, 0x30, 0x3b, 0x66, 0xb7, 0x0a, 0xbb, 0xce,
+  0x25, 0x5b, 0x6c, 0x7e, 0x9a, 0xd0, 0xdf, 0xec, 0x76, 0x1a, 0xfb, 0xa9, 0x6d, 0xdc, 0x35, 0x02,
+  0x69, 0xcc, 0xfe, 0xd7, 0x8a, 0xe7, 0x77, 0xe2, 0xd0, 0x4c, 0x01, 0xdb, 0x34, 0x70, 0x4b, 0xb7,
+  0xef, 0x2f, 0xce, 0x77, 0x3a, 0x94, 0x58, 0x04, 0xfb, 0xb4, 0x33, 0xeb, 0x74, 0x2b, 0xcf, 0x54,
+  0xd7, 0x6c, 0x21, 0x83, 0x86, 0xc0, 0x15, 0xad, 0x02, 0xd7, 0x13, 0x02, 0x8a, 0x85, 0xad, 0xa0,
+  0x6d, 0xe1, 0x9d, 0xbc, 0xbd, 0xdb, 0x28, 0x87, 0x9b, 0x53, 0x6c, 0x9a, 0x89, 0x86, 0xbd, 0x5f,
+  0xe3, 0xd5, 0x54, 0x5a, 0x70, 0xc7, 0xb0, 0x16, 0x26, 0xc3, 0x70, 0x3d, 0x40, 0xd5, 0x80, 0x2e,
+  0xd5, 0x22, 0x7b, 0xdb, 0x45, 0x5e, 0xd8, 0x01, 0xc0, 0x1e, 0xde, 0xb6, 0x60, 0x89, 0x95, 0x54,
+  0x45, 0xe3, 0x6e, 0xb0, 0xe2, 0x96, 0x9e, 0x47, 0x26, 0x0c, 0x0f, 0xdc, 0x37, 0x49, 0x8b, 0xe2,
+  0xd8, 0xb7, 0xa8, 0xc2, 0xe4, 0xa2, 0xff, 0xdb, 0x7e, 0xd4, 0xe0, 0x55, 0xfd, 0xde, 0xba, 0xb0,
+  0x5e, 0xe3, 0x81, 0x86, 0xbb, 0x4b, 0xb3, 0xea, 0xa8, 0xed, 0xb4, 0x02, 0x6b, 0xad, 0xeb, 0x85,
+  0x18, 0xa5, 0x5e, 0x68, 0x45, 0xc9, 0xf9, 0xc8, 0x7e, 0x25, 0xd6, 0xb4, 0xe3, 0x5d, 0x73, 0x54,
+  0xfc, 0x45, 0x1f, 0x74, 0xff, 0xa8, 0x05, 0xb1, 0x28, 0x10, 0xd1, 0xc1, 0xd4, 0x35, 0x2d, 0xb2,
+  0xce, 0xb8, 0xa8, 0x35, 0xc6, 0x81, 0xa8, 0x51, 0x5d, 0x87, 0x90, 0x7d, 0xf1, 0xb0, 0xab, 0xa7,
+  0x55, 0x29, 0x68, 0x4a, 0x0f, 0x5b, 0x08, 0x5a, 0x2f, 0x65, 0xc7, 0x8a, 0xa3, 0xcc, 0xfa, 0x14,
+  0x73, 0x0e, 0x87, 0xaa, 0xb8, 0x3a, 0xf4, 0x20, 0x54, 0xcc, 0x45, 0xf9, 0x3f, 0xfa, 0x4a, 0x27,
+  0x30, 0x51, 0x60, 0x61, 0x68, 0xbf, 0x9d, 0x25, 0x6d, 0xa1, 0x6d, 0xa3, 0x0d, 0xac, 0x74, 0xb5,
+  0xf3, 0x0c, 0x30, 0x9d, 0x31, 0x2a, 0x4c, 0x7b, 0x46, 0x79, 0xaa, 0x27, 0x84, 0x5a, 0x92, 0x21,
+  0x96, 0xf5, 0xa4, 0xe6, 0xcd, 0x5a, 0x3d, 0xa0, 0xae, 0x42, 0x0e, 0x47, 0xf3, 0x18, 0xf2, 0x14,
+  0xff, 0xfa, 0x42, 0x2c, 0xdc, 0x4c, 0x2c, 0x2d, 0x2e, 0x26, 0x1d, 0xc4, 0xbc, 0x2e, 0x8a, 0xc9,
+  0xde, 0x1e, 0xa1, 0x5f, 0xd3, 0xa7, 0x2e, 0xa5, 0xb0, 0xe5, 0xb0, 0x45, 0x4a, 0x39, 0x7a, 0x29,
+  0x5a, 0xbb, 0x82, 0x56, 0x6d, 0xc6, 0x81, 0x28, 0x04, 0xff, 0x28, 0xcd, 0x11, 0xd5, 0x04, 0x89,
+  0x54, 0x4c, 0x47, 0x03, 0x4a, 0x93, 0x34, 0x13, 0xd5, 0xb8, 0xf6, 0x93, 0x4b, 0xe3, 0xf9, 0xaf,
+  0x79, 0x9d, 0xd0, 0xfe, 0x68, 0x78, 0x53, 0xf6, 0xe0, 0xc1, 0xd8, 0xf4, 0xa1, 0xa4, 0x80, 0xfa,
+  0x13, 0x06, 0x1b, 0x93, 0x8f, 0x1b, 0xe3, 0xd1, 0x8d, 0x41, 0xbe, 0x91, 0xb7, 0xd1, 0x72, 0xd0,
+  0xb3, 0x8e, 0x9d, 0x7d, 0xb9, 0x37, 0x98, 0x25, 0x33, 0x36, 0x14, 0xc9, 0xb6, 0x14, 0xce, 0xd1,
+  0x7b, 0x2d, 0xb3, 0x46, 0xcb, 0xb7, 0x16, 0x4b, 0x91, 0x05, 0x99, 0x29, 0x70, 0x53, 0x8b, 0xd2,
+  0x05, 0xa9, 0x04, 0x29, 0xa7, 0x93, 0x57, 0xb0, 0xa8, 0xdb, 0x92, 0xe9, 0x6e, 0xa9, 0x57, 0x14,
+  0x38, 0x7a, 0x4c, 0xdd, 0x05, 0xe2, 0x05, 0xde, 0xb8, 0xc7, 0x44, 0xf3, 0x00, 0xcb, 0xc2, 0xdf,
+  0x88, 0xe3, 0xb7, 0x61, 0x4a, 0xa9, 0x7a, 0x90, 0xca, 0x71, 0x6f, 0x47, 0xf8, 0xb6, 0x75, 0x41,
+  0x65, 0x6a, 0xa3, 0x19, 0x3e, 0x2b, 0x39, 0x36, 0x93, 0x0a, 0xe2, 0xb9, 0x9e, 0x51, 0x4f, 0xa9,
+  0xe6, 0xf5, 0xf5, 0x12, 0xbd, 0x96, 0x18, 0x44, 0xab, 0x4f, 0xbb, 0xa2, 0x83, 0x40, 0x8e, 0x6c,
+  0x90, 0x43, 0x95, 0x0f, 0xf8, 0x87, 0x5c, 0x2f, 0x61, 0x92, 0xe7, 0xa5, 0x03, 0x1e, 0x45, 0x4d,
+  0x9c, 0xf5, 0xf2, 0xad, 0xaa, 0x94, 0xd0, 0xe0, 0x47, 0xdd, 0x06, 0xe1, 0x4c, 0xcd, 0x4c, 0xb0,
+  0x45, 0x0c, 0x6e, 0xa0, 0x33, 0xee, 0x6e, 0x7b, 0xd2, 0xb8, 0x99, 0x08, 0xbe, 0xe1, 0xf9, 0x5d,
+  0xac, 0xd0, 0x57, 0x36, 0xe1, 0x53, 0xd2, 0xb1, 0xde, 0xdf, 0xb5, 0x56, 0xd1, 0x49, 0x7a, 0x46,
+  0x3d, 0xc0, 0xd1, 0x7d, 0x88, 0x6a, 0x98, 0x06, 0x82, 0xec, 0x8d, 0xa4, 0xcb, 0x01, 0x0e, 0xa9,
+  0x1d, 0xcd, 0x21, 0x8a, 0xbe, 0x64, 0x49, 0x5b, 0xdb, 0x66, 0x0a, 0xe4, 0xf4, 0xf6, 0x72, 0xef,
+  0x53, 0xb2, 0x67, 0xa0, 0xae, 0xd1, 0x9c, 0x0b, 0xf8, 0x41, 0x96, 0x66, 0x8e, 0x38, 0x9e, 0x3a,
+  0x6d, 0x69, 0xa0, 0xcd, 0xc9, 0xae, 0xcd, 0x09, 0x67, 0x9b, 0x9f, 0xdf, 0xfa, 0xec, 0x51, 0x60,
+  0xc4, 0xae, 0xca, 0xb1, 0x34, 0x2c, 0x0b, 0xd9, 0xfe, 0xa9, 0x78, 0x09, 0xa9, 0x5b, 0xf4, 0x26,
+  0xd7, 0xfe, 0x48, 0xea, 0xab, 0x55, 0xc6, 0xff, 0x14, 0xf1, 0x4d, 0x1a, 0xcc, 0x1c, 0x09, 0xdb,
+  0xf0, 0xca, 0xaa, 0xdd, 0xc8, 0x6e, 0x31, 0x81, 0xac, 0xf1, 0x56, 0xde, 0xdc, 0xc0, 0x36, 0xfb,
+  0xfc, 0xe4, 0x09, 0xfb, 0x86, 0x7c, 0xef, 0xff, 0xaf, 0x5b, 0x81, 0x47, 0xbf, 0x6f, 0xd3, 0x9b,
+  0xd2, 0xaa, 0xc8, 0x14, 0x32, 0x2a, 0xc9, 0x6c, 0xc9, 0xbf, 0x18, 0x27, 0x0e, 0x79, 0xbc, 0x0f,
+  0x9e, 0xcf, 0x8d, 0xe3, 0xb0, 0x3e, 0xa0, 0xad, 0xae, 0xff, 0xb5, 0x13, 0xda, 0x76, 0x19, 0xfe,
+  0xd4, 0x01, 0x6d, 0xde, 0x62, 0xca, 0x3f, 0x6b, 0xa3, 0x5f, 0x7f, 0xd6, 0x29, 0x42, 0x09, 0xd7,
+  0x63, 0xa3, 0x03, 0xed, 0xe9, 0x83, 0xc9, 0x54, 0xf1, 0xe8, 0xea, 0xff, 0x38, 0x53, 0xff, 0x24,
+  0xcb, 0xd6, 0x85, 0x78, 0x5b, 0xd6, 0x64, 0xd7, 0xfd, 0xa9, 0x59, 0x5d, 0x51, 0x67, 0xc5, 0x64,
+  0x2a, 0x49, 0xf0, 0x80, 0xe0, 0xcf, 0xf6, 0xd4, 0x5f, 0xe5, 0x3a, 0xdb, 0x13, 0x7f, 0x90, 0xee,
+  0x6c, 0x4f, 0xfc, 0x6d, 0xf6, 0xff, 0x01, 0x3f, 0x1d, 0xad, 0x4b, 0xac, 0x5d, 0x00, 0x00,
+};